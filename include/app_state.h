@@ -26,6 +26,11 @@ typedef struct EntityManager_s *EntityManager;
 typedef struct BaseManagerState_s *BaseManagerState;
 typedef struct TowerManagerState_s *TowerManagerState;
 typedef struct HUDManager_s *HUDManager;
+typedef struct SpriteBatch_s *SpriteBatch;
+typedef struct TextureAtlas_s *TextureAtlas;
+typedef struct AssetLoader_s *AssetLoader;
+typedef struct SpatialHash_s *SpatialHash;
+typedef struct RoomHost_s *RoomHost;
 
 // --- Main Application State Structure ---
 
@@ -40,15 +45,28 @@ typedef struct AppState
     SDL_Cursor *cursor;
     SDL_Surface *cursor_surface;
     // --- Timing ---
-    Uint64 last_tick;
-    Uint64 current_tick;
-    float delta_time;
-    Uint64 server_start_time;
-    Uint64 client_start_time;
-    Uint64 sync_clock;
+    Uint64 frame_start_ns;   /**< SDL_GetTicksNS() when the current frame began. */
+    Uint64 accumulator_ns;   /**< Real time not yet consumed by fixed simulation ticks. */
+    float delta_time;        /**< Length of one simulation tick in seconds (constant). */
+    float render_alpha;      /**< Fraction of a tick rendering sits past the last simulated state (0..1). */
+    Uint64 target_frame_ns;  /**< Interval the frame pacer aims for, or 0 when vsync paces frames. */
+    Uint64 next_frame_ns;    /**< Deadline of the next frame on the pacer's schedule. */
+    Uint64 sync_clock;             /**< Shared match clock in ms: the server's SDL_GetTicks(), estimated on clients. Never runs backwards. */
+    Sint64 clock_offset_ms;        /**< Added to SDL_GetTicks() to get sync_clock; slews toward clock_target_offset_ms. */
+    Sint64 clock_target_offset_ms; /**< Best estimate of the server's clock minus ours (0 on the server). */
+    bool clock_synced;             /**< Set once the client has any estimate of the server's clock. */
+    Uint32 rtt_ms;                 /**< Smoothed round-trip time to the server (0 on the server). */
 
     // --- Core State ---
     bool is_server;
+    bool is_dedicated;           /**< Headless server: no window, renderer, assets or local player. */
+    int dedicated_start_players; /**< Number of welcomed clients a dedicated server waits for before starting. */
+    int max_players;             /**< Player slots the server opens (1..MAX_CLIENTS). */
+    int max_minions;             /**< Minion pool limit; clients take the server's value from S_WELCOME. */
+    int max_attacks;             /**< Concurrent attack limit; clients take the server's value from S_WELCOME. */
+    int interpolation_delay_ms;  /**< How far behind their newest received state remote players are drawn. */
+    Uint16 room_id;              /**< Client: room to join. Server: the match this state simulates. */
+    int room_count;              /**< Rooms hosted by this process (0 unless started with --rooms). */
     bool quit_requested;
     bool team;
     GameState currentGameState;
@@ -66,5 +84,10 @@ typedef struct AppState
     NetServerState net_server_state; /**< NULL if not running as server. */
     BaseManagerState base_manager;
     TowerManagerState tower_manager;
+    SpatialHash spatial_hash;
     HUDManager HUD_manager;
+    SpriteBatch sprite_batch;   /**< NULL without a renderer. */
+    TextureAtlas texture_atlas; /**< NULL without a renderer. */
+    AssetLoader asset_loader;   /**< NULL without a renderer. */
+    RoomHost room_host;         /**< NULL unless this process hosts rooms; each room then has its own AppState. */
 } AppState;
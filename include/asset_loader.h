@@ -0,0 +1,71 @@
+#pragma once
+
+// --- Includes ---
+#include "../include/common.h"
+#include "../include/entity.h"
+
+// --- Constants ---
+#define ASSET_LOADER_MAX_WORKERS 4 /**< Upper bound on decode threads, whatever the core count. */
+
+/**
+ * @brief Called on the main thread once every image of a batch has been decoded.
+ * Failed images are NULL (the worker has logged why). The callback may keep a surface by
+ * setting its slot to NULL; the loader destroys every surface left in the array afterwards.
+ * @param state Pointer to the main AppState.
+ * @param surfaces The decoded images, in the order they were queued.
+ * @param count Number of entries in surfaces.
+ */
+typedef void (*AssetBatchReady)(AppState *state, SDL_Surface **surfaces, int count);
+
+// --- Opaque Pointer Type ---
+/**
+ * @brief Opaque handle to the AssetLoader.
+ * Decodes queued images with IMG_Load on worker threads while the main loop keeps running,
+ * then hands each finished batch back to its owner on the main thread, where textures are created.
+ */
+typedef struct AssetLoader_s *AssetLoader;
+
+// --- Public API Function Declarations ---
+
+/**
+ * @brief Initializes the AssetLoader and registers its entity functions.
+ * Must be initialized before any module that queues images.
+ * @param state Pointer to the main AppState.
+ * @return A new AssetLoader instance on success, NULL on failure.
+ * @sa AssetLoader_Destroy
+ */
+AssetLoader AssetLoader_Init(AppState *state);
+
+/**
+ * @brief Stops the workers, releases undelivered images and frees the AssetLoader.
+ * Called by the EntityManager cleanup callback; only call directly if the loader was never registered.
+ * @param loader The AssetLoader instance to destroy.
+ * @sa AssetLoader_Init
+ */
+void AssetLoader_Destroy(AssetLoader loader);
+
+/**
+ * @brief Queues a batch of images to decode. Only valid before AssetLoader_Start.
+ * @param loader The AssetLoader instance.
+ * @param paths Image paths; they are copied.
+ * @param count Number of paths.
+ * @param on_ready Called on the main thread with the decoded batch.
+ * @return True if the batch was queued, false otherwise (error set).
+ */
+bool AssetLoader_QueueImages(AssetLoader loader, const char *const *paths, int count, AssetBatchReady on_ready);
+
+/**
+ * @brief Starts the decode workers and shows loading progress on the lobby HUD.
+ * Call once, after every module has queued its images.
+ * @param loader The AssetLoader instance.
+ * @param state Pointer to the main AppState.
+ * @return True if decoding started, false otherwise (error set).
+ */
+bool AssetLoader_Start(AssetLoader loader, AppState *state);
+
+/**
+ * @brief Tells whether every queued batch has been delivered.
+ * @param loader The AssetLoader instance, may be NULL (nothing to load).
+ * @return True once loading is complete.
+ */
+bool AssetLoader_IsDone(AssetLoader loader);
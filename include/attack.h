@@ -8,6 +8,7 @@
 // --- Project Includes ---
 #include "../include/common.h"
 #include "../include/entity.h"
+#include "../include/sprite_batch.h"
 #include "../include/net_server.h"
 #include "../include/player.h"
 #include "../include/minion.h"
@@ -15,9 +16,11 @@
 #include "../include/camera.h"
 #include "../include/base.h"
 #include "../include/tower.h"
+#include "../include/spatial_hash.h"
 
 // --- Constants ---
-#define MAX_ATTACKS 100 /**< Maximum number of concurrent attacks allowed. */
+#define ATTACK_DEFAULT_MAX 256 /**< Concurrent attack limit unless the server is started with --max-attacks. */
+#define ATTACK_POOL_INITIAL 32  /**< Slots allocated on the first spawn; the pool doubles from there. */
 
 #define PLAYER_ATTACK_SPRITE_FRAME_WIDTH 48
 #define PLAYER_ATTACK_SPRITE_FRAME_HEIGHT 48
@@ -45,7 +48,7 @@ typedef struct AttackManager_s *AttackManager;
 
 /**
  * @brief Initializes the AttackManager module and registers its entity functions.
- * Loads resources required for known attack types.
+ * Looks up the sprites for known attack types in the texture atlas.
  * @param state Pointer to the main AppState.
  * @return A new AttackManager instance on success, NULL on failure.
  * @sa AttackManager_Destroy
@@ -90,4 +93,12 @@ void AttackManager_HandleClientSpawnRequest(AttackManager am, AppState *state, u
  */
 void AttackManager_HandleDestroyObject(AttackManager am, const Msg_DestroyObjectData *data);
 
-void AttackManager_ServerSpawnTowerAttack(AttackManager am, AppState *state, AttackType type, SDL_FPoint target_pos, int towerIndex);
\ No newline at end of file
+void AttackManager_ServerSpawnTowerAttack(AttackManager am, AppState *state, AttackType type, SDL_FPoint target_pos, int towerIndex);
+
+/**
+ * @brief Changes the limit on concurrent attacks, e.g. to the server's value on S_WELCOME.
+ * Already allocated slots are kept even if the new limit is lower.
+ * @param am The AttackManager instance.
+ * @param max_attacks New limit on concurrent attacks.
+ */
+void AttackManager_SetMaxAttacks(AttackManager am, int max_attacks);
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include "../include/common.h"
 #include "../include/camera.h"
 #include "../include/entity.h"
+#include "../include/sprite_batch.h"
 
 // --- Constants ---
 #define MAX_BASES 2
@@ -16,10 +17,6 @@
 #define BASE_RED_POS_X 160.0f
 #define BASE_BLUE_POS_X 3040.0f
 
-#define RED_BASE_PATH "./resources/Sprites/Red_Team/Castle_Red.png"
-#define BLUE_BASE_PATH "./resources/Sprites/Blue_Team/Castle_Blue.png"
-#define DESTROYED_BASE_PATH "./resources/Sprites/Castle_Destroyed.png"
-
 // --- Opaque Pointer Type ---
 /**
  * @brief Opaque handle to the BaseManager state.
@@ -35,10 +32,11 @@ typedef struct BaseInstance
     int index;
     SDL_FRect rect;       /**< Rect for this base. */
     SDL_FPoint position;  /**< World position (center). */
-    SDL_Texture *texture; /**< Texture for this base. */
-    int current_health;   /**< Current health points. */
-    bool team;            /**< Which team the base belongs to. */
+    const AtlasRegion *sprite; /**< Atlas region drawn for this base (NULL without a renderer). */
+    int current_health;        /**< Current health points. */
+    bool team;                 /**< Which team the base belongs to. */
     bool immune;
+    int hud_handle;            /**< HUD element showing this base's health (-1 without a HUD). */
 } BaseInstance;
 
 /**
@@ -46,17 +44,14 @@ typedef struct BaseInstance
  */
 struct BaseManagerState_s
 {
-    BaseInstance bases[MAX_BASES];  /**< Array for the two bases (index 0=Red, 1=Blue). */
-    SDL_Texture *red_texture;       /**< Texture for the red base. */
-    SDL_Texture *blue_texture;      /**< Texture for the blue base. */
-    SDL_Texture *destroyed_texture; /**< Texture for the destroyed base. */
+    BaseInstance bases[MAX_BASES]; /**< Array for the two bases (index 0=Red, 1=Blue). */
 };
 
 // --- Public API Function Declarations ---
 
 /**
  * @brief Initializes the BaseManager module and registers its entity functions.
- * Loads required resources for the bases.
+ * Looks up the base sprites in the texture atlas.
  * @param state Pointer to the main AppState (provides renderer, entity manager).
  * @return A new BaseManagerState instance on success, NULL on failure.
  * @sa BaseManager_Destroy
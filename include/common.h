@@ -25,7 +25,9 @@
 #define BUFFER_SIZE 512
 #define SERVER_PORT 8080
 #define DEFAULT_HOSTNAME "localhost"
-#define MAX_CLIENTS 4
+#define MAX_CLIENTS 16        // Size of the client ID space every peer allocates for; a server opens at most this many slots
+#define DEFAULT_MAX_PLAYERS 10 // Player slots a server opens unless started with --max-players (5v5)
+#define DEDICATED_DEFAULT_START_PLAYERS 2 // A dedicated server starts the match once this many clients have joined
 #define BLUE_TEAM 0
 #define RED_TEAM 1
 
@@ -48,3 +50,4 @@ typedef enum FontSize
 
 // --- Universal Macros ---
 #define CLAMP(val, min, max) ((val) < (min) ? (min) : ((val) > (max) ? (max) : (val)))
+#define LERP(a, b, t) ((a) + ((b) - (a)) * (t))
@@ -47,6 +47,14 @@ typedef struct EntityFunctions
      */
     void (*update)(EntityManager manager, AppState *state);
 
+    /**
+     * @brief Optional function called once per frame after every entity's update has run.
+     * Used for work that must see the results of the whole update pass (e.g., flushing network output).
+     * @param manager The EntityManager instance managing this entity.
+     * @param state Pointer to the main AppState.
+     */
+    void (*late_update)(EntityManager manager, AppState *state);
+
     /**
      * @brief Optional function called once per frame for rendering.
      * @param manager The EntityManager instance managing this entity.
@@ -94,7 +102,8 @@ bool EntityManager_Add(EntityManager manager, const EntityFunctions *funcs);
 void EntityManager_HandleEventsAll(EntityManager manager, AppState *state, SDL_Event *event);
 
 /**
- * @brief Calls the update function for all registered entities that have one.
+ * @brief Calls the update function for all registered entities that have one,
+ * followed by the late_update function for all registered entities that have one.
  * @param manager The EntityManager instance.
  * @param state Pointer to the main AppState.
  */
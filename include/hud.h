@@ -9,6 +9,7 @@
 #define HUD_DEFAULT_FONT_SIZE 28
 #define HUD_SMALL_FONT_SIZE 14
 #define HUD_MAX_ELEMENTS_AMOUNT 100
+#define HUD_NAME_INDEX_SIZE 256 // Power of two, kept above twice HUD_MAX_ELEMENTS_AMOUNT for short probes
 
 // --- Opaque Pointer Type ---
 
@@ -37,12 +38,38 @@ HUDManager HUDManager_Init(AppState *state);
  */
 // void HUDManager_Destroy(HUDManager hm);
 
-void create_hud_instance(AppState *state, int index, char name[], bool changeable);
+/**
+ * @brief Registers a named HUD element and returns its handle.
+ * Call once when the owner is created and keep the handle for per-frame updates.
+ * Registering a name again returns the existing handle.
+ * @param state Pointer to the main AppState.
+ * @param name Unique element name.
+ * @param changeable Whether the element's text is expected to change.
+ * @return The element handle, or -1 if there is no HUD or no free element.
+ */
+int create_hud_instance(AppState *state, const char name[], bool changeable);
 
+/**
+ * @brief Sets the text, color, position and font of a HUD element and makes it visible.
+ * An empty string hides the element. Invalid handles (e.g. -1) are ignored.
+ * @param state Pointer to the main AppState.
+ * @param index The element handle returned by create_hud_instance.
+ * @param text_buffer The text to show.
+ * @param color Text color.
+ * @param dest_point Top-left screen position.
+ * @param fontSize Which font to use.
+ */
 void update_hud_instance(AppState *state, int index, char text_buffer[], SDL_Color color, SDL_FPoint dest_point, FontSize fontSize);
 
 int get_hud_element_count(HUDManager hm);
 
-int get_hud_index_by_name(AppState *state, char name[]);
+/**
+ * @brief Looks up a HUD element handle by name through a hash index.
+ * Prefer keeping the handle from create_hud_instance on hot paths.
+ * @param state Pointer to the main AppState.
+ * @param name The element name.
+ * @return The element handle, or -1 if not found.
+ */
+int get_hud_index_by_name(AppState *state, const char name[]);
 
 void hud_finish_msg(AppState *state);
\ No newline at end of file
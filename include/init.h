@@ -13,8 +13,11 @@
 #include "../include/attack.h"
 #include "../include/player.h"
 #include "../include/camera.h"
+#include "../include/sprite_batch.h"
+#include "../include/asset_loader.h"
 #include "../include/net_server.h"
 #include "../include/net_client.h"
+#include "../include/room_host.h"
 #include "../include/update.h"
 #include "../include/render.h"
 #include "../include/iterate.h"
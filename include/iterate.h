@@ -6,13 +6,14 @@
 #include "../include/render.h"
 
 // --- Constants ---
-#define TARGET_FPS 144
-#define TARGET_FRAME_TIME_MS (1000 / TARGET_FPS)
+#define TARGET_FPS 144 // Default frame rate of a rendering instance; override with --fps N
 
 // --- Function Declarations ---
 
 /**
- * @brief Waits for the appropriate time to maintain the target frame rate.
+ * @brief Waits until the next frame deadline to maintain the target frame rate.
+ * Deadlines advance by a fixed interval so delay overshoot does not accumulate into drift.
+ * Does nothing when vsync paces the frames.
  * Called by SDL_AppIterate in init.c.
  * @param appstate Void pointer to the main AppState struct.
  */
@@ -14,6 +14,7 @@
 // --- Constants ---
 #define MAP_TILE_WIDTH 16  /**< Width of a single tile in pixels. */
 #define MAP_TILE_HEIGHT 16 /**< Height of a single tile in pixels. */
+#define MAP_CHUNK_SIZE_PX 512 /**< Edge length of the textures the static tile layers are baked into. */
 
 // --- Opaque Pointer Type ---
 /**
@@ -26,7 +27,8 @@ typedef struct MapState_s *MapState;
 
 /**
  * @brief Initializes the Map module and registers its entity functions.
- * Loads the map data from the specified file and prepares textures.
+ * Loads the precompiled binary map (see map_format.h) and queues the tileset images on the
+ * AssetLoader; the map is drawn once they have been decoded and uploaded.
  * @param state Pointer to the main AppState.
  * @return A new MapState instance on success, NULL on failure.
  * @sa Map_Destroy
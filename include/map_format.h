@@ -0,0 +1,50 @@
+#pragma once
+
+// --- Standard Library Includes ---
+#include <stdint.h>
+
+/*
+ * Precompiled map format, produced from the Tiled JSON export by tools/map_convert.c
+ * and used in place by the Map module without any parsing.
+ *
+ * Layout (host byte order, every section 4-byte aligned):
+ *   MapBinHeader
+ *   MapBinTileset[tileset_count]             at tileset_offset
+ *   uint16_t gids[layer_count][height][width] at layer_offset, visible tile layers in draw order
+ *
+ * This header is shared with the converter, so it only depends on the C standard library.
+ */
+
+// --- Constants ---
+#define MAP_BIN_MAGIC 0x50414D4Cu   /**< "LMAP" when read on a little-endian host. */
+#define MAP_BIN_VERSION 1u          /**< Bumped whenever the layout below changes. */
+#define MAP_BIN_IMAGE_PATH_MAX 120  /**< Size of the NUL-terminated tileset image path. */
+
+/**
+ * @brief File header, at offset 0.
+ */
+typedef struct MapBinHeader
+{
+    uint32_t magic;          /**< MAP_BIN_MAGIC; a mismatch also catches a file written on a host of the other endianness. */
+    uint32_t version;        /**< MAP_BIN_VERSION. */
+    uint32_t file_size;      /**< Total file size in bytes. */
+    uint32_t width;          /**< Map width in tiles. */
+    uint32_t height;         /**< Map height in tiles. */
+    uint32_t tile_width;     /**< Tile width in pixels. */
+    uint32_t tile_height;    /**< Tile height in pixels. */
+    uint32_t tileset_count;  /**< Number of MapBinTileset entries. */
+    uint32_t tileset_offset; /**< Byte offset of the tileset table. */
+    uint32_t layer_count;    /**< Number of gid arrays. */
+    uint32_t layer_offset;   /**< Byte offset of the first gid array; the others follow contiguously. */
+} MapBinHeader;
+
+/**
+ * @brief One tileset, the subset of the Tiled tileset the renderer needs.
+ */
+typedef struct MapBinTileset
+{
+    uint32_t firstgid;                  /**< GID of the tileset's first tile. */
+    uint32_t tilecount;                 /**< Number of tiles in the tileset. */
+    uint32_t columns;                   /**< Tile columns in the tileset image. */
+    char image[MAP_BIN_IMAGE_PATH_MAX]; /**< Image path, relative to the working directory like the JSON export. */
+} MapBinTileset;
@@ -1,18 +1,21 @@
 #pragma once
 
 #include "../include/entity.h"
+#include "../include/sprite_batch.h"
 #include "../include/common.h"
 #include "../include/net_client.h"
 #include "../include/base.h"
 #include "../include/player.h"
+#include "../include/spatial_hash.h"
 
-#define BLUE_MINION_PATH "./resources/Sprites/Blue_Team/Warrior_Blue.png"
-#define RED_MINION_PATH "./resources/Sprites/Red_Team/Warrior_Red.png"
 #define MINION_WIDTH 16.0f
 #define MINION_HEIGHT 32.0f
 #define MINION_HEALTH_MAX 100.
 #define MINION_WAVE_AMOUNT 6
-#define MINION_MAX_AMOUNT 24
+#define MINION_DEFAULT_MAX 96 /**< Minion pool limit unless the server is started with --max-minions. */
+#define MINION_POOL_INITIAL (MINION_WAVE_AMOUNT * 2) /**< Slots allocated on first spawn; the pool doubles from there. */
+#define MINION_WAVE_SLOTS (MINION_WAVE_AMOUNT * 2)   /**< Minions in a full wave, one per team for each pair. */
+#define MINION_WAVE_PLAN_QUEUE 4                      /**< Announced waves a peer holds before spawning them. */
 #define MINION_ATTACK_COOLDOWN 1000
 
 #define MINION_SPEED 150.0f
@@ -29,15 +32,26 @@
 typedef struct MinionData MinionData;
 typedef struct MinionManager_s *MinionManager;
 
+/**
+ * @brief Slots the server picked for one wave, in spawn order (blue then red for each pair).
+ */
+typedef struct MinionWavePlan
+{
+    Uint16 wave;                  /**< Number of the wave, counted from 0 at game start. */
+    int slots[MINION_WAVE_SLOTS]; /**< Minion pool index of each minion of the wave. */
+    int slot_count;               /**< Number of valid slots, always even. */
+} MinionWavePlan;
+
 struct MinionData
 {
     bool team;
     SDL_FPoint position;      /**< Current world position (center). */
+    SDL_FPoint prev_position; /**< Position at the previous simulation tick, for render interpolation. */
     SDL_FRect sprite_portion; /**< The source rect defining the current animation frame. */
     SDL_FlipMode flip_mode;   /**< Rendering flip state (horizontal). */
     bool active;              /**< Whether this minion slot is currently in use. */
     bool is_attacking;
-    SDL_Texture *texture;
+    const AtlasRegion *sprite; /**< Atlas region of this minion's team spritesheet. */
     int current_health; /**< Current health points. */
     float anim_timer;
     int current_frame;
@@ -46,9 +60,19 @@ struct MinionData
 
 struct MinionManager_s
 {
-    MinionData minions[MINION_MAX_AMOUNT];
-    SDL_Texture *red_texture;
-    SDL_Texture *blue_texture;
+    MinionData *minions;  /**< Minion pool, indexed by the minion index sent over the network. */
+    int minion_capacity;  /**< Slots allocated in minions; loops run up to this. */
+    int max_minions;      /**< Upper bound on minion_capacity, taken from the server once welcomed. */
+    int *free_slots;      /**< Stack of reusable slots, lowest index on top. */
+    int free_count;       /**< Entries in free_slots. */
+    int *released_slots;  /**< Slots of minions that died since the last wave was planned (server only). */
+    int released_count;   /**< Entries in released_slots. */
+    MinionWavePlan wave_plans[MINION_WAVE_PLAN_QUEUE]; /**< Announced waves not fully spawned yet, oldest at wave_plan_head. */
+    int wave_plan_head;   /**< Index in wave_plans of the wave spawning next. */
+    int wave_plan_count;  /**< Entries in wave_plans. */
+    Uint16 next_wave;     /**< Number of the next wave the server plans, or a client expects. */
+    const AtlasRegion *red_sprite;  /**< Red warrior spritesheet (NULL without a renderer). */
+    const AtlasRegion *blue_sprite; /**< Blue warrior spritesheet (NULL without a renderer). */
     Uint64 minionWaveTimer;
     Uint64 recentMinionTimer;
     int activeMinionAmount;
@@ -60,3 +84,13 @@ MinionManager MinionManager_Init(AppState *state);
 void MinionManager_Destroy(MinionManager mm);
 void damageMinion(AppState state, int minionIndex, float damageValue, bool senToServer, float sentCurrentHealth);
 bool MinionManager_GetMinionPosition(MinionManager mm, int minionIndex, SDL_FPoint *out_pos);
+void MinionManager_SetMaxMinions(MinionManager mm, int max_minions);
+
+/**
+ * @brief Queues the slots of an upcoming wave, as announced in S_MINION_WAVE.
+ * Waves spawn on the shared clock as before, but only into the slots the server picked.
+ * @param mm The MinionManager instance.
+ * @param wave The decoded S_MINION_WAVE.
+ * @return True if the wave was queued, false if the queue is full (error set).
+ */
+bool MinionManager_QueueWave(MinionManager mm, const Msg_MinionWaveData *wave);
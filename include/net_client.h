@@ -8,6 +8,9 @@
 #include "../include/attack.h"
 #include "../include/entity.h"
 #include "../include/hud.h"
+#include "../include/net_codec.h"
+#include "../include/net_delta.h"
+#include "../include/net_frame.h"
 
 // --- Opaque Pointer Type ---
 /**
@@ -0,0 +1,176 @@
+#pragma once
+
+// --- Includes ---
+#include "../include/common.h"
+
+// --- Constants ---
+#define NET_CODEC_MAX_MESSAGE_SIZE 64      /**< Upper bound on the encoded size of any single message. */
+#define NET_CODEC_POSITION_FRACTION_BITS 4 /**< Positions are sent as unsigned 12.4 fixed point (0..4095.9375 px). */
+
+// Field bits of a player state delta. A field is on the wire only if its bit is set.
+#define PLAYER_STATE_FIELD_POSITION 0x01 /**< position (2 x u16 fixed point). */
+#define PLAYER_STATE_FIELD_ANIM 0x02     /**< anim_row, anim_frame (2 x u8). */
+#define PLAYER_STATE_FIELD_FLAGS 0x04    /**< flip_mode and team (u8 bit set). */
+#define PLAYER_STATE_FIELD_HEALTH 0x08   /**< current_health (i16). */
+#define PLAYER_STATE_FIELD_ALL 0x0F
+#define PLAYER_STATE_KEYFRAME 0x80 /**< Set when the delta is not based on a previous state. */
+
+// --- Byte Stream Helpers ---
+
+/**
+ * @brief Sequential little-endian writer over a caller-provided buffer.
+ * Writes past the end set the overflow flag instead of touching memory.
+ */
+typedef struct NetWriter
+{
+    Uint8 *data;   /**< Destination buffer. */
+    int capacity;  /**< Size of the destination buffer in bytes. */
+    int length;    /**< Number of bytes written so far. */
+    bool overflow; /**< Set if any write did not fit. */
+} NetWriter;
+
+/**
+ * @brief Sequential little-endian reader over a received message.
+ * Reads past the end return zero and set the overflow flag.
+ */
+typedef struct NetReader
+{
+    const Uint8 *data; /**< Source buffer. */
+    int length;        /**< Size of the source buffer in bytes. */
+    int offset;        /**< Number of bytes consumed so far. */
+    bool overflow;     /**< Set if any read ran past the end. */
+} NetReader;
+
+void NetWriter_Init(NetWriter *w, void *buffer, int capacity);
+void NetWriter_U8(NetWriter *w, Uint8 value);
+void NetWriter_U16(NetWriter *w, Uint16 value);
+void NetWriter_I16(NetWriter *w, Sint16 value);
+void NetWriter_U32(NetWriter *w, Uint32 value);
+void NetWriter_U64(NetWriter *w, Uint64 value);
+void NetWriter_F32(NetWriter *w, float value);
+
+/**
+ * @brief Writes a world position quantized to two 16-bit fixed point coordinates.
+ * Coordinates outside the representable range are clamped.
+ * @param w The writer.
+ * @param value The world position in pixels.
+ */
+void NetWriter_Position(NetWriter *w, SDL_FPoint value);
+
+void NetReader_Init(NetReader *r, const void *buffer, int length);
+Uint8 NetReader_U8(NetReader *r);
+Uint16 NetReader_U16(NetReader *r);
+Sint16 NetReader_I16(NetReader *r);
+Uint32 NetReader_U32(NetReader *r);
+Uint64 NetReader_U64(NetReader *r);
+float NetReader_F32(NetReader *r);
+SDL_FPoint NetReader_Position(NetReader *r);
+
+/**
+ * @brief Fixed header in front of every player state delta.
+ */
+typedef struct NetPlayerStateHeader
+{
+    uint8_t message_type; /**< MSG_TYPE_C_PLAYER_STATE or MSG_TYPE_S_PLAYER_STATE. */
+    uint8_t client_id;    /**< The player this state belongs to. */
+    Uint16 seq;           /**< Sequence number of this state on its link. */
+    Uint16 baseline_seq;  /**< Sequence number of the state the delta was taken against. */
+    Uint16 timestamp;     /**< Owner's clock (ms, wrapping) when the state was taken. */
+    uint8_t field_mask;   /**< PLAYER_STATE_FIELD_* bits present, plus PLAYER_STATE_KEYFRAME. */
+} NetPlayerStateHeader;
+
+// --- Message Encoders ---
+// Each encoder writes the wire form of a message into out and returns the encoded
+// length in bytes, or -1 if out_size is too small (use SDL_GetError()).
+
+int NetCodec_EncodeHello(const Msg_HelloData *msg, void *out, int out_size);
+int NetCodec_EncodeWelcome(const Msg_WelcomeData *msg, void *out, int out_size);
+int NetCodec_EncodeGameStart(const Msg_GameStart *msg, void *out, int out_size);
+int NetCodec_EncodePlayerDisconnect(const Msg_PlayerDisconnectData *msg, void *out, int out_size);
+int NetCodec_EncodeClientSpawnAttack(const Msg_ClientSpawnAttackData *msg, void *out, int out_size);
+int NetCodec_EncodeServerSpawnAttack(const Msg_ServerSpawnAttackData *msg, void *out, int out_size);
+int NetCodec_EncodeDestroyObject(const Msg_DestroyObjectData *msg, void *out, int out_size);
+int NetCodec_EncodeDamagePlayer(const Msg_DamagePlayer *msg, void *out, int out_size);
+int NetCodec_EncodeDamageMinion(const Msg_DamageMinion *msg, void *out, int out_size);
+int NetCodec_EncodeDamageTower(const Msg_DamageTower *msg, void *out, int out_size);
+int NetCodec_EncodeDamageBase(const Msg_DamageBase *msg, void *out, int out_size);
+int NetCodec_EncodeMatchResult(const Msg_MatchResult *msg, void *out, int out_size);
+int NetCodec_EncodeUdpHello(const Msg_UdpHelloData *msg, void *out, int out_size);
+int NetCodec_EncodeStateAck(const Msg_StateAckData *msg, void *out, int out_size);
+int NetCodec_EncodePlayerInput(const Msg_PlayerInputData *msg, void *out, int out_size);
+int NetCodec_EncodeInputAck(const Msg_InputAckData *msg, void *out, int out_size);
+int NetCodec_EncodeTimePing(const Msg_TimePingData *msg, void *out, int out_size);
+int NetCodec_EncodeTimePong(const Msg_TimePongData *msg, void *out, int out_size);
+int NetCodec_EncodeMinionWave(const Msg_MinionWaveData *msg, void *out, int out_size);
+
+// --- Message Decoders ---
+// Each decoder parses a received message into its in-memory struct and returns
+// false if the message is truncated.
+
+bool NetCodec_DecodeHello(const void *data, int length, Msg_HelloData *out);
+bool NetCodec_DecodeWelcome(const void *data, int length, Msg_WelcomeData *out);
+bool NetCodec_DecodeGameStart(const void *data, int length, Msg_GameStart *out);
+bool NetCodec_DecodePlayerDisconnect(const void *data, int length, Msg_PlayerDisconnectData *out);
+bool NetCodec_DecodeClientSpawnAttack(const void *data, int length, Msg_ClientSpawnAttackData *out);
+bool NetCodec_DecodeServerSpawnAttack(const void *data, int length, Msg_ServerSpawnAttackData *out);
+bool NetCodec_DecodeDestroyObject(const void *data, int length, Msg_DestroyObjectData *out);
+bool NetCodec_DecodeDamagePlayer(const void *data, int length, Msg_DamagePlayer *out);
+bool NetCodec_DecodeDamageMinion(const void *data, int length, Msg_DamageMinion *out);
+bool NetCodec_DecodeDamageTower(const void *data, int length, Msg_DamageTower *out);
+bool NetCodec_DecodeDamageBase(const void *data, int length, Msg_DamageBase *out);
+bool NetCodec_DecodeMatchResult(const void *data, int length, Msg_MatchResult *out);
+bool NetCodec_DecodeUdpHello(const void *data, int length, Msg_UdpHelloData *out);
+bool NetCodec_DecodeStateAck(const void *data, int length, Msg_StateAckData *out);
+bool NetCodec_DecodePlayerInput(const void *data, int length, Msg_PlayerInputData *out);
+bool NetCodec_DecodeInputAck(const void *data, int length, Msg_InputAckData *out);
+bool NetCodec_DecodeTimePing(const void *data, int length, Msg_TimePingData *out);
+bool NetCodec_DecodeTimePong(const void *data, int length, Msg_TimePongData *out);
+bool NetCodec_DecodeMinionWave(const void *data, int length, Msg_MinionWaveData *out);
+
+// --- Player State Deltas ---
+
+/**
+ * @brief Rounds a player state to the precision it has on the wire.
+ * Both ends keep quantized copies as baselines so their comparisons agree exactly.
+ * @param msg The state to quantize in place.
+ */
+void NetCodec_QuantizePlayerState(Msg_PlayerStateData *msg);
+
+/**
+ * @brief Compares two quantized player states.
+ * @param msg The new state.
+ * @param baseline The state to compare against.
+ * @return The PLAYER_STATE_FIELD_* bits that differ (0 if nothing changed).
+ */
+Uint8 NetCodec_PlayerStateChanges(const Msg_PlayerStateData *msg, const Msg_PlayerStateData *baseline);
+
+/**
+ * @brief Encodes a player state as a delta against a baseline.
+ * @param msg The quantized state to send.
+ * @param baseline The baseline the receiver already has, or NULL to send a keyframe with every field.
+ * @param seq Sequence number of this state.
+ * @param baseline_seq Sequence number of the baseline (ignored for keyframes).
+ * @param out Destination buffer.
+ * @param out_size Size of the destination buffer.
+ * @return Encoded length in bytes, or -1 if out_size is too small.
+ */
+int NetCodec_EncodePlayerStateDelta(const Msg_PlayerStateData *msg, const Msg_PlayerStateData *baseline, Uint16 seq, Uint16 baseline_seq, void *out, int out_size);
+
+/**
+ * @brief Reads only the fixed header of a player state delta.
+ * @param data The received message.
+ * @param length Length of the received message.
+ * @param out Receives the header fields.
+ * @return False if the message is truncated.
+ */
+bool NetCodec_DecodePlayerStateHeader(const void *data, int length, NetPlayerStateHeader *out);
+
+/**
+ * @brief Applies a player state delta on top of its baseline.
+ * @param data The received message.
+ * @param length Length of the received message.
+ * @param baseline The state named by the header's baseline_seq, or NULL for keyframes.
+ * @param out Receives the reconstructed state.
+ * @return False if the message is truncated or a required baseline is missing.
+ */
+bool NetCodec_DecodePlayerStateDelta(const void *data, int length, const Msg_PlayerStateData *baseline, Msg_PlayerStateData *out);
@@ -0,0 +1,94 @@
+#pragma once
+
+// --- Includes ---
+#include "../include/common.h"
+#include "../include/net_codec.h"
+
+// --- Constants ---
+#define NET_DELTA_HISTORY 32             /**< Number of recent states kept per link for use as baselines. */
+#define PLAYER_STATE_KEEPALIVE_MS 1000   /**< An unchanged player still sends an empty delta this often. */
+#define PLAYER_STATE_INTERVAL_MS 50      /**< A changing player sends its state this often; receivers interpolate between states. */
+
+// --- Delta Link State ---
+
+/**
+ * @brief Sending end of one player-state link (one player's state towards one peer).
+ * Remembers what was sent so the next state can be expressed as a delta against
+ * the most recent state the peer is known to have.
+ */
+typedef struct NetDeltaSender
+{
+    Msg_PlayerStateData history[NET_DELTA_HISTORY]; /**< Quantized states sent, indexed by seq % NET_DELTA_HISTORY. */
+    Uint16 next_seq;                                 /**< Sequence number for the next state. */
+    Uint16 acked_seq;                                /**< Newest state the peer is known to have. */
+    bool has_ack;                                    /**< False until the peer has acknowledged any state. */
+    Uint64 last_send_time;                           /**< Tick (ms) of the last state sent on this link. */
+} NetDeltaSender;
+
+/**
+ * @brief Receiving end of one player-state link.
+ * Keeps the recent states received so incoming deltas can be applied to the baseline they name.
+ */
+typedef struct NetDeltaReceiver
+{
+    Msg_PlayerStateData history[NET_DELTA_HISTORY]; /**< States received, indexed by seq % NET_DELTA_HISTORY. */
+    Uint16 seqs[NET_DELTA_HISTORY];                  /**< Sequence number stored in each history slot. */
+    bool valid[NET_DELTA_HISTORY];                   /**< Whether each history slot holds a state. */
+    Uint16 latest_seq;                               /**< Newest sequence number applied. */
+    bool has_latest;                                 /**< False until a state has been applied. */
+} NetDeltaReceiver;
+
+// --- Public API Function Declarations ---
+
+/**
+ * @brief Checks whether sequence number a is newer than b, allowing for wrap-around.
+ * @param a First sequence number.
+ * @param b Second sequence number.
+ * @return True if a comes after b.
+ */
+bool NetDelta_SeqNewer(Uint16 a, Uint16 b);
+
+/**
+ * @brief Clears a sender so its next state goes out as a keyframe.
+ * @param tx The sender to reset.
+ */
+void NetDelta_ResetSender(NetDeltaSender *tx);
+
+/**
+ * @brief Clears a receiver, forgetting every stored baseline.
+ * @param rx The receiver to reset.
+ */
+void NetDelta_ResetReceiver(NetDeltaReceiver *rx);
+
+/**
+ * @brief Encodes the next state on a link as a delta against the newest acknowledged state.
+ * Nothing is produced when the state is unchanged and the keepalive interval has not elapsed.
+ * @param tx The sending end of the link.
+ * @param current The state to send (message_type and client_id must be set).
+ * @param now Current tick in ms.
+ * @param out Destination buffer.
+ * @param out_size Size of the destination buffer.
+ * @param out_seq Receives the sequence number assigned to the encoded state (may be NULL).
+ * @return Encoded length in bytes, 0 if there is nothing to send, or -1 on failure.
+ * @sa NetDelta_Ack
+ */
+int NetDelta_EncodePlayerState(NetDeltaSender *tx, const Msg_PlayerStateData *current, Uint64 now, void *out, int out_size, Uint16 *out_seq);
+
+/**
+ * @brief Records that the peer has received the state with the given sequence number.
+ * On a reliable stream every state that was queued successfully counts as received.
+ * @param tx The sending end of the link.
+ * @param seq Sequence number of the received state.
+ */
+void NetDelta_Ack(NetDeltaSender *tx, Uint16 seq);
+
+/**
+ * @brief Decodes a player-state delta and records the result as a future baseline.
+ * States older than the newest one already applied are rejected.
+ * @param rx The receiving end of the link.
+ * @param data The received message.
+ * @param length Length of the received message.
+ * @param out Receives the reconstructed state.
+ * @return True if out holds a new state, false if the message was stale, truncated or its baseline is unknown.
+ */
+bool NetDelta_DecodePlayerState(NetDeltaReceiver *rx, const void *data, int length, Msg_PlayerStateData *out);
@@ -0,0 +1,89 @@
+#pragma once
+
+// --- Includes ---
+#include "../include/common.h"
+
+// --- Constants ---
+#define NET_FRAME_HEADER_SIZE 2    /**< Size of the little-endian length prefix in front of every frame. */
+#define NET_FRAME_MAX_PAYLOAD 1024 /**< Largest payload a single frame may carry. */
+#define NET_RECV_BUFFER_SIZE 8192  /**< Capacity of a per-connection receive ring buffer. Must be a power of two. */
+#define NET_SEND_QUEUE_SIZE 8192   /**< Capacity of a per-connection outbound batch queue. */
+
+// --- Receive Accumulator ---
+
+/**
+ * @brief Per-connection ring buffer that accumulates raw stream bytes until whole frames are available.
+ * TCP may coalesce several frames into one read or split a frame across reads, so bytes are
+ * buffered here and only complete frames are handed to the message dispatcher.
+ */
+typedef struct NetRecvBuffer
+{
+    Uint8 data[NET_RECV_BUFFER_SIZE]; /**< Ring storage. */
+    int head;                         /**< Index of the first unread byte. */
+    int count;                        /**< Number of unread bytes currently stored. */
+} NetRecvBuffer;
+
+// --- Outbound Batch Queue ---
+
+/**
+ * @brief Per-connection queue of encoded frames waiting to be written.
+ * Everything produced during a tick is appended here and written with a single socket call when flushed.
+ */
+typedef struct NetSendQueue
+{
+    Uint8 data[NET_SEND_QUEUE_SIZE]; /**< Back-to-back length-prefixed frames. */
+    int length;                      /**< Number of queued bytes. */
+} NetSendQueue;
+
+// --- Public API Function Declarations ---
+
+/**
+ * @brief Clears a receive buffer, discarding any partially received frame.
+ * Call this whenever the buffer is (re)assigned to a new connection.
+ * @param rb The receive buffer to reset.
+ */
+void NetFrame_ResetRecvBuffer(NetRecvBuffer *rb);
+
+/**
+ * @brief Reads as many pending bytes from a stream socket as fit into the receive buffer.
+ * @param rb The receive buffer to append to.
+ * @param socket The stream socket to read from.
+ * @return Number of bytes read (0 if nothing was pending or the buffer is full), or -1 on a read error / closed connection with nothing read.
+ */
+int NetFrame_ReadFromSocket(NetRecvBuffer *rb, SDLNet_StreamSocket *socket);
+
+/**
+ * @brief Removes the next complete frame from the receive buffer.
+ * @param rb The receive buffer to read from.
+ * @param out_payload Destination for the frame payload (without the length prefix).
+ * @param out_size Size of out_payload in bytes; should be at least NET_FRAME_MAX_PAYLOAD.
+ * @return Payload length of the frame, 0 if no complete frame is buffered yet, or -1 if the stream is corrupt.
+ */
+int NetFrame_PopFrame(NetRecvBuffer *rb, void *out_payload, int out_size);
+
+/**
+ * @brief Clears an outbound queue, discarding any frames not yet flushed.
+ * Call this whenever the queue is (re)assigned to a new connection.
+ * @param queue The send queue to reset.
+ */
+void NetFrame_ResetSendQueue(NetSendQueue *queue);
+
+/**
+ * @brief Appends a length-prefixed frame to an outbound queue.
+ * If the frame does not fit, the queue is flushed to the socket first so no message is dropped.
+ * @param queue The send queue to append to.
+ * @param socket The stream socket the queue belongs to (used only for an early flush).
+ * @param payload Pointer to the message bytes.
+ * @param length Number of payload bytes (1..NET_FRAME_MAX_PAYLOAD).
+ * @return True if the frame was queued, false on failure (use SDL_GetError()).
+ * @sa NetFrame_FlushSendQueue
+ */
+bool NetFrame_QueueFrame(NetSendQueue *queue, SDLNet_StreamSocket *socket, const void *payload, int length);
+
+/**
+ * @brief Writes all queued frames to the socket in a single call and empties the queue.
+ * @param queue The send queue to flush.
+ * @param socket The stream socket to write to.
+ * @return True if the queue was empty or the write succeeded, false on failure (use SDL_GetError()).
+ */
+bool NetFrame_FlushSendQueue(NetSendQueue *queue, SDLNet_StreamSocket *socket);
@@ -4,6 +4,9 @@
 #include "../include/common.h"
 #include "../include/attack.h"
 #include "../include/entity.h"
+#include "../include/net_codec.h"
+#include "../include/net_delta.h"
+#include "../include/net_frame.h"
 #include "../include/tower.h"
 
 // --- Opaque Pointer Type ---
@@ -26,6 +29,18 @@ typedef struct NetServerState_s *NetServerState;
  */
 NetServerState NetServer_Init(AppState *state);
 
+/**
+ * @brief Initializes a server for one room of a RoomHost and registers its entity functions.
+ * The server opens no sockets: the RoomHost accepts its clients (see NetServer_AdoptClient) and
+ * hands it its datagrams (see NetServer_HandleDatagram). Replies go out on the shared datagram socket.
+ * @param state Pointer to the room's AppState.
+ * @param room_id Room the server runs; C_HELLO must name it.
+ * @param udp_socket The RoomHost's datagram socket (may be NULL, in which case player state uses TCP only).
+ * @return A new NetServerState instance on success, NULL on failure.
+ * @sa NetServer_Destroy
+ */
+NetServerState NetServer_InitRoom(AppState *state, Uint16 room_id, SDLNet_DatagramSocket *udp_socket);
+
 /**
  * @brief Destroys the NetServerState instance, closes the listening socket,
  * and disconnects all clients.
@@ -45,3 +60,33 @@ void NetServer_Destroy(NetServerState ns_state);
  * @param exclude_client_index Index of a client to skip sending to (-1 to broadcast to all).
  */
 void NetServer_BroadcastMessage(NetServerState ns_state, const void *buffer, int length, int exclude_client_index);
+
+/**
+ * @brief Moves the session from the lobby into a running match and tells every client to start.
+ * Called by the host's "start" command, or automatically by a dedicated server once enough players joined.
+ * @param ns_state The NetServerState instance (may be NULL, in which case only the local state changes).
+ * @param state Pointer to the main AppState.
+ */
+void NetServer_StartGame(NetServerState ns_state, AppState *state);
+
+/**
+ * @brief Takes over a connection whose C_HELLO was already read, and answers that hello.
+ * @param ns_state The room's NetServerState instance.
+ * @param socket The connection; owned by the server on success.
+ * @param hello The C_HELLO frame payload.
+ * @param hello_length Length of hello in bytes.
+ * @param state Pointer to the room's AppState.
+ * @return True on success, false if the room is full or arguments are invalid (use SDL_GetError()).
+ */
+bool NetServer_AdoptClient(NetServerState ns_state, SDLNet_StreamSocket *socket, const void *hello, int hello_length, AppState *state);
+
+/**
+ * @brief Dispatches a datagram if it belongs to one of this server's clients.
+ * A C_UDP_HELLO belongs to the server whose welcomed client it names with the right token; any other
+ * datagram to the server with a client bound to its sender's endpoint. The caller keeps the datagram.
+ * @param ns_state The NetServerState instance.
+ * @param datagram The received datagram.
+ * @param state Pointer to the server's AppState.
+ * @return True if the datagram was handled here.
+ */
+bool NetServer_HandleDatagram(NetServerState ns_state, SDLNet_Datagram *datagram, AppState *state);
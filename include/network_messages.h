@@ -22,6 +22,10 @@ typedef enum MessageType
     MSG_TYPE_C_DAMAGE_TOWER = 5,  /**< Client requests to damage a tower. */
     MSG_TYPE_C_DAMAGE_BASE = 6,   /**< Client requests to damage a base. */
     MSG_TYPE_C_DAMAGE_MINION = 7,  /**< Client sends a request to damage a minion. */
+    MSG_TYPE_C_UDP_HELLO = 8,     /**< Client announces its datagram endpoint (sent over UDP). */
+    MSG_TYPE_C_STATE_ACK = 9,     /**< Client acknowledges player states received over UDP. */
+    MSG_TYPE_C_PLAYER_INPUT = 10, /**< Client sends its latest sequenced movement inputs. */
+    MSG_TYPE_C_TIME_PING = 11,    /**< Client asks for the server's clock, for time synchronization. */
 
 
     MSG_TYPE_C_MATCH_RESULT = 89, /**< Client sends the match result. */
@@ -34,6 +38,11 @@ typedef enum MessageType
     MSG_TYPE_S_DAMAGE_TOWER = 105,  /**< Server confirms/broadcasts damage to a tower. */
     MSG_TYPE_S_DAMAGE_BASE = 106,   /**< Server confirms/broadcasts damage to a basea. */
     MSG_TYPE_S_DAMAGE_MINION = 107,  /**< Serever confirms/broadcast damage to minion. */
+    MSG_TYPE_S_UDP_READY = 108,     /**< Server has bound the client's datagram endpoint (sent over TCP). */
+    MSG_TYPE_S_STATE_ACK = 109,     /**< Server acknowledges player states received over UDP. */
+    MSG_TYPE_S_INPUT_ACK = 110,     /**< Server reports the last input it applied and the resulting position. */
+    MSG_TYPE_S_TIME_PONG = 111,     /**< Server answers C_TIME_PING with its clock. */
+    MSG_TYPE_S_MINION_WAVE = 112,   /**< Server tells every peer which minion slots the next wave spawns into. */
 
     MSG_TYPE_S_GAME_START = 188,
     MSG_TYPE_S_GAME_RESULT = 189,       /**< Server confirms/broadcasts the match result. */
@@ -67,6 +76,19 @@ typedef enum ObjectType
 } ObjectType;
 
 // --- Message Data Structures ---
+// These are the in-memory forms of each message. They are never sent as raw bytes;
+// net_codec.h defines the fixed-width little-endian wire encoding for each of them.
+
+/**
+ * @brief Data structure for MSG_TYPE_C_HELLO.
+ * The first message on a new connection; a server hosting several rooms routes the client by room_id.
+ */
+typedef struct Msg_HelloData
+{
+    uint8_t message_type; /**< Should be MSG_TYPE_C_HELLO. */
+    uint16_t room_id;     /**< Match the client wants to join (0 on a single-match server). */
+    bool team;            /**< Team the client plays for; the server keeps it for the whole connection. */
+} Msg_HelloData;
 
 /**
  * @brief Data structure for MSG_TYPE_S_WELCOME.
@@ -76,8 +98,98 @@ typedef struct Msg_WelcomeData
 {
     uint8_t message_type;       /**< Should be MSG_TYPE_S_WELCOME. */
     uint8_t assigned_client_id; /**< The ID assigned to this client by the server. */
+    uint32_t session_token;     /**< Secret the client echoes in C_UDP_HELLO to claim its datagram endpoint. */
+    uint16_t max_minions;       /**< Server's minion pool limit; minion indices never reach it. */
+    uint16_t max_attacks;       /**< Server's concurrent attack limit. */
 } Msg_WelcomeData;
 
+/**
+ * @brief Data structure for MSG_TYPE_C_UDP_HELLO.
+ * Sent from client to server over UDP until the server answers with S_UDP_READY.
+ */
+typedef struct Msg_UdpHelloData
+{
+    uint8_t message_type;   /**< Should be MSG_TYPE_C_UDP_HELLO. */
+    uint8_t client_id;      /**< The ID assigned in S_WELCOME. */
+    uint32_t session_token; /**< The token received in S_WELCOME. */
+} Msg_UdpHelloData;
+
+#define MSG_STATE_ACK_MAX_ENTRIES 15 /**< Most player links one state ack can cover: every other player when MAX_CLIENTS is 16. */
+
+/**
+ * @brief Data structure for MSG_TYPE_C_STATE_ACK and MSG_TYPE_S_STATE_ACK.
+ * Tells the sender the newest player state received for each player, so it can delta against it.
+ */
+typedef struct Msg_StateAckData
+{
+    uint8_t message_type; /**< MSG_TYPE_C_STATE_ACK or MSG_TYPE_S_STATE_ACK. */
+    uint8_t count;        /**< Number of valid entries. */
+    struct
+    {
+        uint8_t client_id; /**< The player whose state is acknowledged. */
+        uint16_t seq;      /**< Newest sequence number received for that player. */
+    } entries[MSG_STATE_ACK_MAX_ENTRIES];
+} Msg_StateAckData;
+
+#define MSG_PLAYER_INPUT_MAX_COMMANDS 8 /**< Most input commands one C_PLAYER_INPUT carries; older unacknowledged ones are resent for redundancy. */
+
+/**
+ * @brief Data structure for MSG_TYPE_C_PLAYER_INPUT.
+ * Carries consecutive input commands, oldest first, ending with the one numbered newest_seq.
+ */
+typedef struct Msg_PlayerInputData
+{
+    uint8_t message_type;                            /**< Should be MSG_TYPE_C_PLAYER_INPUT. */
+    uint16_t newest_seq;                             /**< Sequence number of the last command. */
+    uint8_t count;                                   /**< Number of valid commands (1..MSG_PLAYER_INPUT_MAX_COMMANDS). */
+    uint8_t buttons[MSG_PLAYER_INPUT_MAX_COMMANDS]; /**< PLAYER_INPUT_* bits of each command. */
+} Msg_PlayerInputData;
+
+/**
+ * @brief Data structure for MSG_TYPE_S_INPUT_ACK.
+ * Sent to the owner of a player after the server has simulated its inputs.
+ */
+typedef struct Msg_InputAckData
+{
+    uint8_t message_type; /**< Should be MSG_TYPE_S_INPUT_ACK. */
+    uint16_t input_seq;   /**< Newest input command applied by the server. */
+    SDL_FPoint position;  /**< Authoritative position after that command. */
+} Msg_InputAckData;
+
+/**
+ * @brief Data structure for MSG_TYPE_C_TIME_PING.
+ */
+typedef struct Msg_TimePingData
+{
+    uint8_t message_type; /**< Should be MSG_TYPE_C_TIME_PING. */
+    Uint64 client_time;   /**< Client's SDL_GetTicks() when the ping was sent. */
+} Msg_TimePingData;
+
+/**
+ * @brief Data structure for MSG_TYPE_S_TIME_PONG.
+ */
+typedef struct Msg_TimePongData
+{
+    uint8_t message_type; /**< Should be MSG_TYPE_S_TIME_PONG. */
+    Uint64 client_time;   /**< client_time of the ping being answered. */
+    Uint64 server_time;   /**< Server's SDL_GetTicks() when the ping was answered. */
+} Msg_TimePongData;
+
+#define MSG_MINION_WAVE_MAX_SLOTS 12 /**< Most minion slots one S_MINION_WAVE carries: a full wave of pairs. */
+
+/**
+ * @brief Data structure for MSG_TYPE_S_MINION_WAVE.
+ * Slots are listed in spawn order, blue then red for each pair; only slots whose minion death has
+ * already been relayed to every client are reused, so all peers address the wave's minions alike.
+ */
+typedef struct Msg_MinionWaveData
+{
+    uint8_t message_type;                       /**< Should be MSG_TYPE_S_MINION_WAVE. */
+    uint16_t wave;                              /**< Number of the wave, counted from 0 at game start. */
+    uint8_t count;                              /**< Number of valid slots (even, 0..MSG_MINION_WAVE_MAX_SLOTS). */
+    uint16_t slots[MSG_MINION_WAVE_MAX_SLOTS]; /**< Minion pool index of each minion of the wave. */
+} Msg_MinionWaveData;
+
 /**
  * @brief Data structure for MSG_TYPE_S_GAME_START.
  * Sent from server to all clients to indicate the game start.
@@ -94,13 +206,15 @@ typedef struct Msg_GameStart
  */
 typedef struct Msg_PlayerStateData
 {
-    uint8_t message_type;     /**< MSG_TYPE_C_PLAYER_STATE or MSG_TYPE_S_PLAYER_STATE. */
-    uint8_t client_id;        /**< The ID of the player this state belongs to. */
-    SDL_FPoint position;      /**< Current world position (x, y). */
-    SDL_FRect sprite_portion; /**< Current source rect for animation frame. */
-    SDL_FlipMode flip_mode;   /**< Current horizontal flip state. */
+    uint8_t message_type;   /**< MSG_TYPE_C_PLAYER_STATE or MSG_TYPE_S_PLAYER_STATE. */
+    uint8_t client_id;      /**< The ID of the player this state belongs to. */
+    SDL_FPoint position;    /**< Current world position (x, y). */
+    uint8_t anim_row;       /**< Sprite sheet row of the current animation. */
+    uint8_t anim_frame;     /**< Frame index within the current animation row. */
+    SDL_FlipMode flip_mode; /**< Current horizontal flip state. */
     bool team;
     int current_health;
+    uint16_t timestamp; /**< Owner's clock (ms, wrapping) when the state was taken; travels in the delta header, not as a field. */
 } Msg_PlayerStateData;
 
 
@@ -208,4 +322,4 @@ typedef struct Msg_MatchResult
 {
     uint8_t message_type; /**< Should be MSG_TYPE_S_. */
     bool winningTeam;
-} Msg_MatchResult;
\ No newline at end of file
+} Msg_MatchResult;
\ No newline at end of file
@@ -17,6 +17,7 @@
 #include "../include/base.h"
 #include "../include/tower.h"
 #include "../include/entity.h"
+#include "../include/sprite_batch.h"
 
 // --- Constants ---
 #define PLAYER_WIDTH 32.0f
@@ -40,8 +41,18 @@
 #define PLAYER_SPRITE_NUM_ATTACK_FRAMES 6
 #define PLAYER_SPRITE_TIME_PER_FRAME 0.1f /**< Duration each animation frame is displayed. */
 
-#define RED_WIZARD_PATH "./resources/Sprites/Red_Team/Fire_Wizard/Fire_Wizard_Spiresheet.png"
-#define BLUE_WIZARD_PATH "./resources/Sprites/Blue_Team/Lightning_Wizard/Lightning_Wizard_Spritesheet.png"
+#define PLAYER_SNAPSHOT_COUNT 16                                   /**< Received states kept per remote player. */
+#define PLAYER_INTERP_DELAY_DEFAULT_MS (2 * PLAYER_STATE_INTERVAL_MS) /**< Remote players are drawn this far in the past, so one late or lost state is bridged. */
+#define PLAYER_EXTRAPOLATION_MAX_MS 100                            /**< How long a walking remote player keeps going once states stop arriving. */
+
+#define PLAYER_INPUT_HISTORY 64 /**< Unacknowledged input commands kept for replay (about one second of ticks). */
+
+// Bits of an input command. The same command moves the player on the client and on the server.
+#define PLAYER_INPUT_UP 0x01
+#define PLAYER_INPUT_DOWN 0x02
+#define PLAYER_INPUT_LEFT 0x04
+#define PLAYER_INPUT_RIGHT 0x08
+#define PLAYER_INPUT_SPAWN 0x10 /**< The player is placed at its team's spawn point before moving. */
 
 // --- Opaque Pointer Type ---
 
@@ -51,6 +62,27 @@
  */
 typedef struct PlayerManager_s *PlayerManager;
 
+/**
+ * @brief One tick of local player input, numbered so the server can acknowledge it.
+ */
+typedef struct PlayerInputCommand
+{
+    Uint16 seq;    /**< Sequence number, one per simulation tick with input. */
+    Uint8 buttons; /**< PLAYER_INPUT_* bits. */
+} PlayerInputCommand;
+
+/**
+ * @brief One received state of a remote player, placed on the owner's clock.
+ */
+typedef struct PlayerSnapshot
+{
+    Sint64 time;              /**< Owner's clock in ms, unwrapped from the 16-bit wire timestamp. */
+    SDL_FPoint position;      /**< World position (center). */
+    SDL_FRect sprite_portion; /**< Animation frame shown at this state. */
+    int current_frame;        /**< Frame index within the animation row. */
+    SDL_FlipMode flip_mode;   /**< Horizontal flip state. */
+} PlayerSnapshot;
+
 /**
  * @brief Holds all state data for a single player instance (local or remote).
  */
@@ -59,8 +91,9 @@ typedef struct PlayerInstance
     int index;
     SDL_FRect rect;
     SDL_FPoint position;      /**< Current world position (center). */
+    SDL_FPoint prev_position; /**< Position at the previous simulation tick, for render interpolation. */
     SDL_FRect sprite_portion; /**< The source rect defining the current animation frame. */
-    SDL_Texture *texture;
+    const AtlasRegion *sprite; /**< Atlas region of this player's team spritesheet. */
     SDL_FlipMode flip_mode; /**< Rendering flip state (horizontal). */
     float anim_timer;       /**< Timer used to advance animation frames. */
     int current_frame;      /**< Index of the current frame within the current animation sequence. */
@@ -73,7 +106,12 @@ typedef struct PlayerInstance
     bool playDeathAnim;
     bool playHurtAnim;
     bool playAttackAnim;
+    bool spawn_pending; /**< Position was reset to the spawn point; the next input command tells the server. */
     int current_health; /**< Current health points. */
+    int hud_handle;     /**< HUD element showing this player's health (-1 without a HUD). */
+    PlayerSnapshot snapshots[PLAYER_SNAPSHOT_COUNT]; /**< Remote players only: received states, oldest first. */
+    int snapshot_count;                              /**< Number of valid snapshots. */
+    Sint64 clock_offset;                             /**< Local ms minus owner ms, kept near its smallest sample so late states do not drag playback. */
 } PlayerInstance;
 
 /**
@@ -83,16 +121,18 @@ struct PlayerManager_s
 {
     PlayerInstance players[MAX_CLIENTS]; /**< Array holding data for all potential players. */
     int local_player_client_id;          /**< Client ID of the local player, or -1 if none/disconnected. */
-    SDL_Texture *player_texture;         /**< Shared texture atlas for player sprites. */
-    SDL_Texture *red_texture;
-    SDL_Texture *blue_texture;
+    const AtlasRegion *red_sprite;       /**< Fire wizard spritesheet (NULL without a renderer). */
+    const AtlasRegion *blue_sprite;      /**< Lightning wizard spritesheet (NULL without a renderer). */
+    PlayerInputCommand input_history[PLAYER_INPUT_HISTORY]; /**< Local input commands, indexed by seq % PLAYER_INPUT_HISTORY. */
+    Uint16 next_input_seq;                                  /**< Sequence number of the next input command. */
+    Uint16 acked_input_seq;                                 /**< Newest command the server has applied; later ones are pending. */
 };
 
 // --- Public API Function Declarations ---
 
 /**
  * @brief Initializes the PlayerManager module and registers its entity functions.
- * Creates the manager state and loads common player resources.
+ * Creates the manager state and looks up the player sprites in the texture atlas.
  * @param state Pointer to the main AppState.
  * @return A new PlayerManager instance on success, NULL on failure.
  * @sa PlayerManager_Destroy
@@ -118,8 +158,10 @@ void PlayerManager_Destroy(PlayerManager pm);
 bool PlayerManager_SetLocalPlayerID(AppState *state, uint8_t client_id);
 
 /**
- * @brief Updates the state of a remote player based on received network data.
- * Creates or updates the player data in the manager's internal array.
+ * @brief Buffers a received state of a remote player.
+ * Creates the player on its first state. The player is then drawn interpolation_delay_ms
+ * behind the newest state, interpolating between buffered states and briefly extrapolating
+ * a walking player when states stop arriving. Health is applied immediately.
  * @param pm The PlayerManager instance.
  * @param data Pointer to the received Msg_PlayerStateData.
  */
@@ -142,6 +184,16 @@ void PlayerManager_RemovePlayer(PlayerManager pm, uint8_t client_id);
  */
 bool PlayerManager_GetLocalPlayerPosition(PlayerManager pm, SDL_FPoint *out_pos);
 
+/**
+ * @brief Gets the local player's position interpolated between the last two simulation ticks.
+ * Used by the Camera so it moves in step with the drawn player.
+ * @param pm The PlayerManager instance.
+ * @param alpha Interpolation factor between the previous (0) and current (1) tick.
+ * @param out_pos Pointer to an SDL_FPoint to store the position.
+ * @return True if the local player exists and position was retrieved, false otherwise.
+ */
+bool PlayerManager_GetLocalPlayerRenderPosition(PlayerManager pm, float alpha, SDL_FPoint *out_pos);
+
 /**
  * @brief Gets the world position of any active player by their client ID.
  * Used by other systems like AttackManager or TowerManager.
@@ -161,4 +213,42 @@ bool PlayerManager_GetPlayerPosition(PlayerManager pm, uint8_t client_id, SDL_FP
  */
 bool PlayerManager_GetLocalPlayerState(PlayerManager pm, Msg_PlayerStateData *out_data);
 
+/**
+ * @brief Gets the point a player of the given team spawns and respawns at.
+ * @param team The player's team.
+ * @return The spawn position in world coordinates.
+ */
+SDL_FPoint Player_GetSpawnPosition(bool team);
+
+/**
+ * @brief Moves a player by one input command, with tower/base collision and map clamping.
+ * Shared by client prediction, client replay and the server's authoritative simulation,
+ * so all three produce the same position from the same commands.
+ * @param state The main application state (towers, bases and map are read).
+ * @param position The player's position, updated in place.
+ * @param team The player's team, for PLAYER_INPUT_SPAWN.
+ * @param buttons PLAYER_INPUT_* bits of the command.
+ * @param delta_time Length of the tick the command covers.
+ */
+void Player_ApplyInput(AppState *state, SDL_FPoint *position, bool team, Uint8 buttons, float delta_time);
+
+/**
+ * @brief Copies the newest input commands the server has not acknowledged yet.
+ * @param pm The PlayerManager instance.
+ * @param out Receives the commands, oldest first.
+ * @param max_count Capacity of out.
+ * @return Number of commands copied.
+ */
+int PlayerManager_GetPendingInputs(PlayerManager pm, PlayerInputCommand *out, int max_count);
+
+/**
+ * @brief Corrects the local player with the server's authoritative result.
+ * Restarts from the server position and replays every command the server has not applied yet.
+ * Acks older than the newest one already handled are ignored.
+ * @param state Pointer to the main AppState.
+ * @param acked_seq Newest input command the server applied.
+ * @param server_position The server's position for the player after that command.
+ */
+void PlayerManager_ReconcileLocalPlayer(AppState *state, Uint16 acked_seq, SDL_FPoint server_position);
+
 void damagePlayer(AppState state, int playerIndex, float damageValue, bool sendToServer);
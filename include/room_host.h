@@ -0,0 +1,41 @@
+#pragma once
+
+// --- Includes ---
+#include "../include/common.h"
+#include "../include/entity.h"
+
+// --- Constants ---
+#define ROOM_MAX_COUNT 64          /**< Upper bound on --rooms; room ids travel in C_HELLO. */
+#define ROOM_PENDING_MAX 32        /**< Connections that may wait for their C_HELLO at the same time. */
+#define ROOM_HELLO_TIMEOUT_MS 5000 /**< A connection that has not sent C_HELLO by then is closed. */
+#define ROOM_RETRY_MIN_MS 1000     /**< Wait before creating a room again after a failed attempt; doubles with each failure. */
+#define ROOM_RETRY_MAX_MS 30000    /**< Longest wait between attempts to create a room. */
+
+// --- Opaque Pointer Type ---
+/**
+ * @brief Opaque handle to the RoomHost.
+ * Runs several independent matches ("rooms") in one dedicated server process. Each room has its
+ * own AppState with its own simulation modules and NetServer; the RoomHost owns the listening and
+ * datagram sockets, routes new connections by the room id in their C_HELLO, hands datagrams to the
+ * room whose client sent them, and ticks every room. A room whose match is over and empty is
+ * replaced by a fresh one.
+ */
+typedef struct RoomHost_s *RoomHost;
+
+// --- Public API Function Declarations ---
+
+/**
+ * @brief Opens the server sockets, creates state->room_count rooms and registers the entity functions.
+ * The rooms take their limits (players, minions, attacks, start count) from state.
+ * @param state Pointer to the process's AppState (dedicated, with no simulation modules of its own).
+ * @return A new RoomHost instance on success, NULL on failure.
+ * @sa RoomHost_Destroy
+ */
+RoomHost RoomHost_Init(AppState *state);
+
+/**
+ * @brief Destroys every room, closes pending connections and the sockets, and frees the RoomHost.
+ * @param host The RoomHost instance to destroy.
+ * @sa RoomHost_Init
+ */
+void RoomHost_Destroy(RoomHost host);
@@ -0,0 +1,83 @@
+#pragma once
+
+// --- Includes ---
+#include "../include/common.h"
+#include "../include/entity.h"
+
+// --- Constants ---
+#define SPATIAL_HASH_CELL_SIZE 64.0f /**< Cell side in pixels: four 16 px map tiles, about one minion or player. */
+#define SPATIAL_HASH_BUCKETS 256     /**< Hash buckets; must be a power of two. */
+
+/**
+ * @brief Kinds of object stored in the grid, usable as a query mask.
+ * Query results come back in this order (then by index), matching the order the
+ * collision code has always resolved hits in.
+ */
+typedef enum SpatialKind
+{
+    SPATIAL_KIND_TOWER = 1 << 0,
+    SPATIAL_KIND_BASE = 1 << 1,
+    SPATIAL_KIND_MINION = 1 << 2,
+    SPATIAL_KIND_PLAYER = 1 << 3,
+    SPATIAL_KIND_ALL = 0xF
+} SpatialKind;
+
+/**
+ * @brief One query result.
+ */
+typedef struct SpatialHit
+{
+    SpatialKind kind; /**< What the object is. */
+    int index;        /**< Its index in the owning manager's array. */
+} SpatialHit;
+
+// --- Opaque Pointer Type ---
+/**
+ * @brief Opaque handle to the SpatialHash.
+ * Uniform grid over every tower, base, minion and player, rebuilt at the start of each
+ * simulation tick so collision and targeting code only looks at nearby objects.
+ */
+typedef struct SpatialHash_s *SpatialHash;
+
+// --- Public API Function Declarations ---
+
+/**
+ * @brief Initializes the SpatialHash and registers its entity functions.
+ * Must be registered after the network modules and before every module that queries it,
+ * so the grid reflects this tick's positions when they update.
+ * @param state Pointer to the main AppState.
+ * @return A new SpatialHash instance on success, NULL on failure.
+ * @sa SpatialHash_Destroy
+ */
+SpatialHash SpatialHash_Init(AppState *state);
+
+/**
+ * @brief Frees the SpatialHash.
+ * Called by the EntityManager cleanup callback; only call directly if the grid was never registered.
+ * @param grid The SpatialHash instance to destroy.
+ * @sa SpatialHash_Init
+ */
+void SpatialHash_Destroy(SpatialHash grid);
+
+/**
+ * @brief Finds the objects whose bounds overlap a rectangle (edges included).
+ * This is a broad phase: callers still run their exact hit test on each result.
+ * @param grid The SpatialHash instance.
+ * @param rect Query rectangle in world pixels; may have zero size to query a point.
+ * @param kinds Mask of SpatialKind values to return.
+ * @param out_count Receives the number of results.
+ * @return The results, valid until the next query or rebuild; NULL if there are none.
+ */
+const SpatialHit *SpatialHash_QueryRect(SpatialHash grid, const SDL_FRect *rect, Uint32 kinds, int *out_count);
+
+/**
+ * @brief Finds the objects whose bounds come within a radius of a point.
+ * This is a broad phase: callers still run their exact range test on each result.
+ * @param grid The SpatialHash instance.
+ * @param center Query center in world pixels.
+ * @param radius Query radius in pixels.
+ * @param kinds Mask of SpatialKind values to return.
+ * @param out_count Receives the number of results.
+ * @return The results, valid until the next query or rebuild; NULL if there are none.
+ */
+const SpatialHit *SpatialHash_QueryRange(SpatialHash grid, SDL_FPoint center, float radius, Uint32 kinds, int *out_count);
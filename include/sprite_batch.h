@@ -0,0 +1,83 @@
+#pragma once
+
+// --- Includes ---
+#include "../include/common.h"
+#include "../include/entity.h"
+#include "../include/texture_atlas.h"
+
+// --- Constants ---
+#define SPRITE_BATCH_INITIAL_CAPACITY 256 /**< Sprites the batch holds before its buffers first grow. */
+
+/**
+ * @brief Draw layers, lowest first. Sprites are sorted by layer before texture,
+ * so the order between entity kinds stays what the EntityManager order used to give.
+ */
+typedef enum SpriteDepth
+{
+    SPRITE_DEPTH_BUILDINGS = 0,
+    SPRITE_DEPTH_ATTACKS = 1,
+    SPRITE_DEPTH_PLAYERS = 2,
+    SPRITE_DEPTH_MINIONS = 3,
+} SpriteDepth;
+
+// --- Opaque Pointer Type ---
+/**
+ * @brief Opaque handle to the SpriteBatch.
+ * Collects textured quads during the render pass and submits them with as few
+ * SDL_RenderGeometry calls as possible, one per run of sprites sharing a texture.
+ */
+typedef struct SpriteBatch_s *SpriteBatch;
+
+// --- Public API Function Declarations ---
+
+/**
+ * @brief Initializes the SpriteBatch module and registers its entity functions.
+ * Its render callback submits the queued sprites, so it must be initialized after
+ * every module that draws through it.
+ * @param state Pointer to the main AppState.
+ * @return A new SpriteBatch instance on success, NULL on failure.
+ * @sa SpriteBatch_Destroy
+ */
+SpriteBatch SpriteBatch_Init(AppState *state);
+
+/**
+ * @brief Destroys the SpriteBatch instance and its buffers.
+ * Called by the EntityManager cleanup callback; only call directly if the batch was never registered.
+ * @param batch The SpriteBatch instance to destroy.
+ * @sa SpriteBatch_Init
+ */
+void SpriteBatch_Destroy(SpriteBatch batch);
+
+/**
+ * @brief Queues a textured quad, with the same meaning as SDL_RenderTextureRotated around the quad's center.
+ * @param batch The SpriteBatch instance.
+ * @param texture The texture to sample.
+ * @param src Source rect in texture pixels, or NULL for the whole texture.
+ * @param dst Destination rect in render coordinates.
+ * @param angle_deg Clockwise rotation in degrees.
+ * @param flip Horizontal/vertical flip.
+ * @param depth Draw layer; lower layers are drawn first.
+ */
+void SpriteBatch_Draw(SpriteBatch batch, SDL_Texture *texture, const SDL_FRect *src, const SDL_FRect *dst,
+                      double angle_deg, SDL_FlipMode flip, SpriteDepth depth);
+
+/**
+ * @brief Queues a quad sampling a texture atlas region, see SpriteBatch_Draw.
+ * @param batch The SpriteBatch instance.
+ * @param region The atlas region to sample; NULL draws nothing.
+ * @param src Source rect relative to the region's top-left corner, or NULL for the whole region;
+ *            a rect reaching outside the region draws nothing.
+ * @param dst Destination rect in render coordinates.
+ * @param angle_deg Clockwise rotation in degrees.
+ * @param flip Horizontal/vertical flip.
+ * @param depth Draw layer; lower layers are drawn first.
+ */
+void SpriteBatch_DrawRegion(SpriteBatch batch, const AtlasRegion *region, const SDL_FRect *src, const SDL_FRect *dst,
+                            double angle_deg, SDL_FlipMode flip, SpriteDepth depth);
+
+/**
+ * @brief Submits every queued sprite, sorted by depth then texture, and empties the batch.
+ * @param batch The SpriteBatch instance.
+ * @param renderer The renderer to draw with.
+ */
+void SpriteBatch_Flush(SpriteBatch batch, SDL_Renderer *renderer);
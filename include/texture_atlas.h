@@ -0,0 +1,75 @@
+#pragma once
+
+// --- Includes ---
+#include "../include/common.h"
+#include "../include/entity.h"
+
+// --- Constants ---
+#define ATLAS_MAX_PAGE_SIZE 4096 /**< Upper bound on an atlas page side, lowered to the renderer's limit if needed. */
+#define ATLAS_MAX_PAGES 4        /**< Pages the packer may open before giving up. */
+#define ATLAS_PADDING 2          /**< Transparent pixels kept between packed sprites so neighbours never bleed in. */
+
+/**
+ * @brief Every sprite image packed into the atlas.
+ */
+typedef enum AtlasSpriteId
+{
+    ATLAS_SPRITE_BASE_RED = 0,
+    ATLAS_SPRITE_BASE_BLUE,
+    ATLAS_SPRITE_BASE_DESTROYED,
+    ATLAS_SPRITE_TOWER_RED,
+    ATLAS_SPRITE_TOWER_BLUE,
+    ATLAS_SPRITE_TOWER_DESTROYED,
+    ATLAS_SPRITE_MINION_RED,
+    ATLAS_SPRITE_MINION_BLUE,
+    ATLAS_SPRITE_WIZARD_RED,
+    ATLAS_SPRITE_WIZARD_BLUE,
+    ATLAS_SPRITE_FIREBALL,
+    ATLAS_SPRITE_LIGHTNING_ARROW,
+    ATLAS_SPRITE_COUNT
+} AtlasSpriteId;
+
+/**
+ * @brief Where one sprite image lives inside the atlas.
+ */
+typedef struct AtlasRegion
+{
+    SDL_Texture *texture; /**< Atlas page holding the sprite. */
+    SDL_FRect rect;       /**< Sprite bounds on the page, in pixels. */
+} AtlasRegion;
+
+// --- Opaque Pointer Type ---
+/**
+ * @brief Opaque handle to the TextureAtlas.
+ * Packs every image under resources/Sprites into as few textures as possible at startup
+ * so that sprites from different managers can share one SpriteBatch run.
+ */
+typedef struct TextureAtlas_s *TextureAtlas;
+
+// --- Public API Function Declarations ---
+
+/**
+ * @brief Queues every sprite image on the AssetLoader and registers the atlas entity.
+ * The pages are packed on the main thread once the images are decoded; until then regions
+ * have a NULL texture. Must be initialized before any module that looks up regions.
+ * @param state Pointer to the main AppState (requires a renderer and an AssetLoader not yet started).
+ * @return A new TextureAtlas instance on success, NULL on failure.
+ * @sa TextureAtlas_Destroy
+ */
+TextureAtlas TextureAtlas_Init(AppState *state);
+
+/**
+ * @brief Destroys the atlas pages and the TextureAtlas instance.
+ * Called by the EntityManager cleanup callback; only call directly if the atlas was never registered.
+ * @param atlas The TextureAtlas instance to destroy.
+ * @sa TextureAtlas_Init
+ */
+void TextureAtlas_Destroy(TextureAtlas atlas);
+
+/**
+ * @brief Looks up where a sprite was packed.
+ * @param atlas The TextureAtlas instance, may be NULL (no renderer).
+ * @param id The sprite to look up.
+ * @return The sprite's region, or NULL if there is no atlas or the id is out of range.
+ */
+const AtlasRegion *TextureAtlas_Get(TextureAtlas atlas, AtlasSpriteId id);
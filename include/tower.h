@@ -7,8 +7,10 @@
 #include "../include/minion.h"
 #include "../include/attack.h"
 #include "../include/entity.h"
+#include "../include/sprite_batch.h"
 #include "../include/base.h"
 #include "../include/hud.h"
+#include "../include/spatial_hash.h"
 
 // --- Constants ---
 #define MAX_TOWERS_PER_TEAM 2
@@ -42,12 +44,13 @@ typedef struct TowerInstance
     bool team;                   /**< Which team the tower belongs to. */
     SDL_FRect rect;              /**< Rect for this tower. */
     SDL_FPoint position;         /**< World position (center or base). */
-    SDL_Texture *texture;        /**< Texture for this tower. */
+    const AtlasRegion *sprite;   /**< Atlas region drawn for this tower (NULL without a renderer). */
     float current_health;        /**< Current health points. */
     float attack_cooldown_timer; /**< Time remaining until the next attack can occur. */
     bool teamFirstTower;
     bool immune;
     bool destroyed;
+    int hud_handle;              /**< HUD element showing this tower's health (-1 without a HUD). */
 } TowerInstance;
 
 /**
@@ -56,9 +59,6 @@ typedef struct TowerInstance
 struct TowerManagerState_s
 {
     TowerInstance towers[MAX_TOTAL_TOWERS]; /**< Array for all towers. */
-    SDL_Texture *red_texture;               /**< Texture for red towers. */
-    SDL_Texture *blue_texture;              /**< Texture for blue towers. */
-    SDL_Texture *destroyed_texture;         /**< Texture for destroyed towers. */
     int tower_count;                        /**< Number of initialized towers. */
 };
 
@@ -66,7 +66,7 @@ struct TowerManagerState_s
 
 /**
  * @brief Initializes the TowerManager module and registers its entity functions.
- * Loads required resources for the towers.
+ * Looks up the tower sprites in the texture atlas.
  * @param state Pointer to the main AppState (provides renderer, entity manager).
  * @return A new TowerManagerState instance on success, NULL on failure.
  * @sa TowerManager_Destroy
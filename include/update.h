@@ -4,11 +4,26 @@
 #include "../include/common.h"
 #include "../include/entity.h"
 
+// --- Constants ---
+#define SIM_TICK_RATE 60                                /**< Simulation ticks per second, independent of the render rate. */
+#define SIM_TICK_NS (SDL_NS_PER_SECOND / SIM_TICK_RATE) /**< Length of one simulation tick. */
+#define SIM_MAX_TICKS_PER_FRAME 5                       /**< Caps catch-up work after a stall; older backlog is dropped. */
+#define CLOCK_SLEW_MS_PER_TICK 1                        /**< Most the shared clock is corrected per tick, so it only runs ~6% fast or slow. */
+#define CLOCK_SNAP_MS 250                               /**< A clock this far behind the estimate jumps forward instead of slewing. */
+
 // --- Function Declarations ---
 
 /**
- * @brief Updates the application state for the current frame.
- * Calculates delta time and calls the update function for all managed entities.
+ * @brief Runs one fixed simulation tick: advances sync_clock and updates every entity.
+ * A process hosting rooms calls this for each room's AppState.
+ * @param state Pointer to the AppState to advance.
+ */
+void app_tick(AppState *state);
+
+/**
+ * @brief Advances the simulation by as many fixed ticks as real time has elapsed.
+ * Leftover time is carried to the next frame and exposed as render_alpha for interpolation.
+ * Each tick also advances sync_clock, slewing it toward the newest estimate of the server's clock.
  * @param appstate Void pointer to the main AppState struct.
  */
 void app_update(void *appstate);
@@ -0,0 +1,339 @@
+#include "../include/asset_loader.h"
+#include "../include/hud.h"
+
+// --- Internal Structures ---
+
+/**
+ * @brief One image to decode.
+ */
+typedef struct AssetJob
+{
+    char *path; /**< Owned copy of the image path. */
+    int batch;  /**< Index of the batch the job belongs to. */
+} AssetJob;
+
+/**
+ * @brief A group of jobs delivered together to one callback.
+ */
+typedef struct AssetBatch
+{
+    AssetBatchReady on_ready; /**< Main-thread callback receiving the decoded images. */
+    int first_job;            /**< Index of the batch's first job. */
+    int count;                /**< Number of jobs in the batch. */
+    SDL_AtomicInt remaining;  /**< Jobs still being decoded; the batch is ready at zero. */
+    bool delivered;           /**< Whether on_ready has run. */
+} AssetBatch;
+
+/**
+ * @brief Internal state for the AssetLoader module.
+ */
+struct AssetLoader_s
+{
+    AssetJob *jobs;                                /**< Every queued image; never reallocated once the workers start. */
+    SDL_Surface **surfaces;                        /**< Decoded image per job, written by a worker; NULL if decoding failed. */
+    int job_count;                                 /**< Number of queued images. */
+    AssetBatch *batches;                           /**< Every queued batch, in queue order. */
+    int batch_count;                               /**< Number of queued batches. */
+    int batches_delivered;                         /**< Batches whose callback has run. */
+    SDL_AtomicInt next_job;                        /**< Next job index a worker will claim. */
+    SDL_AtomicInt completed;                       /**< Jobs finished so far, for progress reporting. */
+    SDL_AtomicInt cancel;                          /**< Set on shutdown so workers stop claiming jobs. */
+    SDL_Thread *workers[ASSET_LOADER_MAX_WORKERS]; /**< Decode threads. */
+    int worker_count;                              /**< Number of threads started. */
+    bool started;                                  /**< Whether AssetLoader_Start has run. */
+    bool finished;                                 /**< Whether every batch was delivered and the workers joined. */
+    Uint64 start_ns;                               /**< When decoding started, for the load-time log. */
+    int hud_handle;                                /**< Lobby HUD element showing progress (-1 without a HUD). */
+    int shown_completed;                           /**< Completed count currently on the HUD, so the text is only rebuilt on change. */
+    bool shown;                                    /**< Whether the progress line is currently on the HUD. */
+};
+
+// --- Static Helper Functions ---
+
+/**
+ * @brief Worker thread: claims jobs until none are left and decodes them.
+ * IMG_Load only touches the surface it returns, so workers never need a lock.
+ * @param data The AssetLoader instance.
+ * @return Always 0.
+ */
+static int asset_worker(void *data)
+{
+    AssetLoader loader = (AssetLoader)data;
+
+    for (;;)
+    {
+        if (SDL_GetAtomicInt(&loader->cancel))
+            break;
+
+        int job_index = SDL_AddAtomicInt(&loader->next_job, 1);
+        if (job_index >= loader->job_count)
+            break;
+
+        const AssetJob *job = &loader->jobs[job_index];
+        loader->surfaces[job_index] = IMG_Load(job->path);
+        if (!loader->surfaces[job_index])
+        {
+            SDL_LogError(SDL_LOG_CATEGORY_ERROR, "[AssetLoader] Failed to load image '%s': %s", job->path, SDL_GetError());
+        }
+
+        // The atomic decrement publishes the surface to the main thread
+        SDL_AddAtomicInt(&loader->batches[job->batch].remaining, -1);
+        SDL_AddAtomicInt(&loader->completed, 1);
+    }
+    return 0;
+}
+
+/**
+ * @brief Joins every worker thread.
+ * @param loader The AssetLoader instance.
+ */
+static void join_workers(AssetLoader loader)
+{
+    for (int i = 0; i < loader->worker_count; ++i)
+    {
+        SDL_WaitThread(loader->workers[i], NULL);
+        loader->workers[i] = NULL;
+    }
+    loader->worker_count = 0;
+}
+
+/**
+ * @brief Hands every fully decoded batch to its callback, in queue order.
+ * @param loader The AssetLoader instance.
+ * @param state Pointer to the main AppState.
+ */
+static void deliver_ready_batches(AssetLoader loader, AppState *state)
+{
+    for (int i = 0; i < loader->batch_count; ++i)
+    {
+        AssetBatch *batch = &loader->batches[i];
+        if (batch->delivered || SDL_GetAtomicInt(&batch->remaining) > 0)
+            continue;
+
+        SDL_Surface **surfaces = &loader->surfaces[batch->first_job];
+        batch->on_ready(state, surfaces, batch->count);
+        batch->delivered = true;
+        loader->batches_delivered++;
+
+        // Whatever the callback did not keep is released here
+        for (int j = 0; j < batch->count; ++j)
+        {
+            if (surfaces[j])
+            {
+                SDL_DestroySurface(surfaces[j]);
+                surfaces[j] = NULL;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Refreshes the lobby progress line, hiding it once loading is done or the lobby is left.
+ * @param loader The AssetLoader instance.
+ * @param state Pointer to the main AppState.
+ */
+static void update_progress_hud(AssetLoader loader, AppState *state)
+{
+    int completed = SDL_GetAtomicInt(&loader->completed);
+    bool shown = !AssetLoader_IsDone(loader) && state->currentGameState == GAME_STATE_LOBBY;
+    if (completed == loader->shown_completed && shown == loader->shown)
+        return;
+    loader->shown_completed = completed;
+    loader->shown = shown;
+
+    char text_buffer[64];
+    if (!shown)
+        text_buffer[0] = '\0';
+    else
+        snprintf(text_buffer, sizeof(text_buffer), "Loading assets... %d%%", completed * 100 / SDL_max(loader->job_count, 1));
+
+    update_hud_instance(state, loader->hud_handle, text_buffer, (SDL_Color){255, 255, 255, 255}, (SDL_FPoint){0.0f, 100.0f}, 1);
+}
+
+// --- Static Callback Functions (for EntityManager) ---
+
+/**
+ * @brief Wrapper function conforming to EntityFunctions.update signature.
+ * Runs in the lobby as well, delivering decoded batches and updating the progress line.
+ * @param manager The EntityManager instance (unused).
+ * @param state Pointer to the main AppState.
+ */
+static void asset_loader_update_callback(EntityManager manager, AppState *state)
+{
+    (void)manager;
+    AssetLoader loader = state ? state->asset_loader : NULL;
+    if (!loader || !loader->started || loader->finished)
+        return;
+
+    deliver_ready_batches(loader, state);
+    update_progress_hud(loader, state);
+
+    if (AssetLoader_IsDone(loader))
+    {
+        join_workers(loader);
+        SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[AssetLoader] %d image(s) loaded in %.1f ms.",
+                    loader->job_count, (double)(SDL_GetTicksNS() - loader->start_ns) / 1e6);
+        loader->finished = true;
+    }
+}
+
+/**
+ * @brief Wrapper function conforming to EntityFunctions.cleanup signature.
+ * @param manager The EntityManager instance (unused).
+ * @param state Pointer to the main AppState.
+ */
+static void asset_loader_cleanup_callback(EntityManager manager, AppState *state)
+{
+    (void)manager;
+    if (!state || !state->asset_loader)
+        return;
+
+    AssetLoader_Destroy(state->asset_loader);
+    state->asset_loader = NULL;
+}
+
+// --- Public API Function Implementations ---
+
+AssetLoader AssetLoader_Init(AppState *state)
+{
+    if (!state || !state->entity_manager)
+    {
+        SDL_SetError("Invalid AppState or missing entity_manager for AssetLoader_Init");
+        return NULL;
+    }
+
+    AssetLoader loader = (AssetLoader)SDL_calloc(1, sizeof(struct AssetLoader_s));
+    if (!loader)
+    {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    loader->hud_handle = -1;
+
+    EntityFunctions loader_funcs = {
+        .name = "asset_loader",
+        .update = asset_loader_update_callback,
+        .cleanup = asset_loader_cleanup_callback,
+        .render = NULL,
+        .handle_events = NULL};
+
+    if (!EntityManager_Add(state->entity_manager, &loader_funcs))
+    {
+        SDL_LogError(SDL_LOG_CATEGORY_ERROR, "[AssetLoader Init] Failed to add entity to manager: %s", SDL_GetError());
+        SDL_free(loader);
+        return NULL;
+    }
+
+    SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "AssetLoader initialized and entity registered.");
+    return loader;
+}
+
+void AssetLoader_Destroy(AssetLoader loader)
+{
+    if (!loader)
+        return;
+
+    SDL_SetAtomicInt(&loader->cancel, 1);
+    join_workers(loader);
+
+    for (int i = 0; i < loader->job_count; ++i)
+    {
+        if (loader->surfaces[i])
+            SDL_DestroySurface(loader->surfaces[i]);
+        SDL_free(loader->jobs[i].path);
+    }
+    SDL_free(loader->jobs);
+    SDL_free(loader->surfaces);
+    SDL_free(loader->batches);
+    SDL_free(loader);
+    SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "AssetLoader destroyed.");
+}
+
+bool AssetLoader_QueueImages(AssetLoader loader, const char *const *paths, int count, AssetBatchReady on_ready)
+{
+    if (!loader || !paths || count <= 0 || !on_ready)
+        return SDL_SetError("Invalid arguments for AssetLoader_QueueImages");
+    if (loader->started)
+        return SDL_SetError("AssetLoader_QueueImages called after AssetLoader_Start");
+
+    AssetJob *jobs = (AssetJob *)SDL_realloc(loader->jobs, (size_t)(loader->job_count + count) * sizeof(AssetJob));
+    if (!jobs)
+        return SDL_OutOfMemory();
+    loader->jobs = jobs;
+
+    SDL_Surface **surfaces = (SDL_Surface **)SDL_realloc(loader->surfaces, (size_t)(loader->job_count + count) * sizeof(SDL_Surface *));
+    if (!surfaces)
+        return SDL_OutOfMemory();
+    loader->surfaces = surfaces;
+
+    AssetBatch *batches = (AssetBatch *)SDL_realloc(loader->batches, (size_t)(loader->batch_count + 1) * sizeof(AssetBatch));
+    if (!batches)
+        return SDL_OutOfMemory();
+    loader->batches = batches;
+
+    for (int i = 0; i < count; ++i)
+    {
+        AssetJob *job = &loader->jobs[loader->job_count + i];
+        loader->surfaces[loader->job_count + i] = NULL;
+        job->batch = loader->batch_count;
+        job->path = SDL_strdup(paths[i]);
+        if (!job->path)
+        {
+            while (--i >= 0)
+                SDL_free(loader->jobs[loader->job_count + i].path);
+            return SDL_OutOfMemory();
+        }
+    }
+
+    AssetBatch *batch = &loader->batches[loader->batch_count++];
+    SDL_zerop(batch);
+    batch->on_ready = on_ready;
+    batch->first_job = loader->job_count;
+    batch->count = count;
+    SDL_SetAtomicInt(&batch->remaining, count);
+
+    loader->job_count += count;
+    return true;
+}
+
+bool AssetLoader_Start(AssetLoader loader, AppState *state)
+{
+    if (!loader || !state)
+        return SDL_SetError("Invalid arguments for AssetLoader_Start");
+    if (loader->started)
+        return SDL_SetError("AssetLoader already started");
+
+    loader->started = true;
+    loader->start_ns = SDL_GetTicksNS();
+    loader->shown_completed = -1;
+    loader->hud_handle = create_hud_instance(state, "lobby_loading_msg", true);
+
+    // Leave one core to the main thread, which keeps rendering and networking meanwhile
+    int workers = SDL_clamp(SDL_GetNumLogicalCPUCores() - 1, 1, ASSET_LOADER_MAX_WORKERS);
+    workers = SDL_min(workers, SDL_max(loader->job_count, 1));
+    for (int i = 0; i < workers; ++i)
+    {
+        loader->workers[i] = SDL_CreateThread(asset_worker, "asset_worker", loader);
+        if (!loader->workers[i])
+        {
+            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[AssetLoader] Could not start worker %d: %s", i, SDL_GetError());
+            break;
+        }
+        loader->worker_count++;
+    }
+
+    // Without any thread the images are decoded right here, as they were before
+    if (loader->worker_count == 0)
+    {
+        asset_worker(loader);
+    }
+
+    SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[AssetLoader] Decoding %d image(s) in %d batch(es) on %d worker(s).",
+                loader->job_count, loader->batch_count, loader->worker_count);
+    return true;
+}
+
+bool AssetLoader_IsDone(AssetLoader loader)
+{
+    return !loader || (loader->started && loader->batches_delivered == loader->batch_count);
+}
@@ -13,13 +13,14 @@ typedef struct AttackInstance
     AttackType type;     /**< The type of attack. */
     uint8_t owner_id;    /**< The client ID of the player who launched the attack. */
     SDL_FPoint position; /**< Current world position (center). */
+    SDL_FPoint prev_position; /**< Position at the previous simulation tick, for render interpolation. */
     SDL_FPoint target;
     SDL_FPoint velocity;  /**< Current velocity vector (pixels per second). */
     float angle_deg;      /**< Current rendering angle in degrees. */
-    SDL_Texture *texture; /**< Texture used for rendering this attack. */
-    float render_width;   /**< Width used for rendering. */
-    float render_height;  /**< Height used for rendering. */
-    float hit_range;      /**< Radius or bounding box size used for collision detection. */
+    const AtlasRegion *sprite; /**< Atlas region used for rendering this attack. */
+    float render_width;        /**< Width used for rendering. */
+    float render_height;       /**< Height used for rendering. */
+    float hit_range;           /**< Radius or bounding box size used for collision detection. */
     ObjectType attacker;
     SDL_FRect sprite_portion; /**< The source rect defining the current animation frame. */
     float anim_timer;         /**< Timer used to advance animation frames. */
@@ -32,11 +33,14 @@ typedef struct AttackInstance
  */
 struct AttackManager_s
 {
-    AttackInstance attacks[MAX_ATTACKS];  /**< Pool of attack instances. */
+    AttackInstance *attacks;              /**< Pool of attack instances; active ones are kept at the front. */
     int active_attack_count;              /**< Number of currently active attacks in the pool. */
-    SDL_Texture *fireball_texture;        /**< Shared texture for fireball attacks. */
-    SDL_Texture *lightning_arrow_texture; /**< Shared texture for lightning arrow attacks. */
-    uint32_t next_attack_id;              /**< Counter for assigning unique attack IDs. */
+    int attack_capacity;                  /**< Slots allocated in attacks. */
+    int max_attacks;                      /**< Upper bound on attack_capacity. */
+    const AtlasRegion *fireball_sprite;        /**< Shared sprite for fireball attacks. */
+    const AtlasRegion *lightning_arrow_sprite; /**< Shared sprite for lightning arrow attacks. */
+    uint32_t next_attack_id;                   /**< Counter for assigning unique attack IDs. */
+    Uint64 minion_hit_time;                    /**< sync_clock of the last minion hit, for the tower hit cooldown. */
 };
 
 // --- Static Helper Functions ---
@@ -64,7 +68,7 @@ static int find_attack_by_id(AttackManager am, uint32_t attack_id)
 
 /**
  * @brief Finds the first inactive slot in the attacks array using the compacting approach.
- * If the active count is less than the max capacity, the next slot is available.
+ * If every allocated slot is active, the pool doubles, up to max_attacks.
  * @param am The AttackManager instance.
  * @return The index of the next available slot, or -1 if the pool is full.
  */
@@ -72,11 +76,25 @@ static int find_inactive_attack_slot(AttackManager am)
 {
     if (!am)
         return -1;
-    if (am->active_attack_count < MAX_ATTACKS)
+    if (am->active_attack_count < am->attack_capacity)
     {
         return am->active_attack_count;
     }
-    SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "Attack pool is full (%d/%d)", am->active_attack_count, MAX_ATTACKS);
+
+    int new_capacity = SDL_min(SDL_max(am->attack_capacity * 2, ATTACK_POOL_INITIAL), am->max_attacks);
+    if (new_capacity > am->attack_capacity)
+    {
+        AttackInstance *attacks = (AttackInstance *)SDL_realloc(am->attacks, (size_t)new_capacity * sizeof(AttackInstance));
+        if (attacks)
+        {
+            // Inactive slots are expected to be zeroed
+            memset(&attacks[am->attack_capacity], 0, (size_t)(new_capacity - am->attack_capacity) * sizeof(AttackInstance));
+            am->attacks = attacks;
+            am->attack_capacity = new_capacity;
+            return am->active_attack_count;
+        }
+    }
+    SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "Attack pool is full (%d/%d)", am->active_attack_count, am->max_attacks);
     return -1;
 }
 
@@ -114,13 +132,12 @@ static void update_single_attack(AttackInstance *attack, AppState *state)
         return;
 
     // --- Movement ---
+    attack->prev_position = attack->position;
     attack->position.x += attack->velocity.x * state->delta_time;
     attack->position.y += attack->velocity.y * state->delta_time;
 
     update_attack_animation(attack, state->delta_time);
 
-    static Uint64 attack_cooldown = 0;
-
     // --- Boundary Check / Lifetime ---
     if (state->map_state)
     {
@@ -131,69 +148,74 @@ static void update_single_attack(AttackInstance *attack, AppState *state)
 
         if (distance_to_target < attack->hit_range)
         {
+            // Only objects near the impact can be hit, so ask the grid instead of scanning every array
+            SDL_FRect attackRect = {attack->position.x, attack->position.y, attack->render_width, attack->render_height};
+            int hit_count = 0;
+            const SpatialHit *hits = SpatialHash_QueryRect(state->spatial_hash, &attackRect, SPATIAL_KIND_ALL, &hit_count);
+
             if (attack->attacker == OBJECT_TYPE_PLAYER)
             {
                 if (attack->owner_id == NetClient_GetClientID(state->net_client_state))
                 {
-                    for (int i = 0; i < MAX_TOTAL_TOWERS; i++)
+                    for (int h = 0; h < hit_count; h++)
                     {
-                        TowerInstance tempTower = state->tower_manager->towers[i];
-                        if (tempTower.team != state->team)
+                        int i = hits[h].index;
+                        if (hits[h].kind == SPATIAL_KIND_TOWER)
                         {
-                            if (SDL_PointInRectFloat(&attack->position, &tempTower.rect))
+                            TowerInstance tempTower = state->tower_manager->towers[i];
+                            if (tempTower.team != state->team)
                             {
-                                SDL_Log("Attack Hit Tower %d", i);
-                                damageTower(*state, i, PLAYER_ATTACK_DAMAGE_VALUE, true, 0);
+                                if (SDL_PointInRectFloat(&attack->position, &tempTower.rect))
+                                {
+                                    SDL_Log("Attack Hit Tower %d", i);
+                                    damageTower(*state, i, PLAYER_ATTACK_DAMAGE_VALUE, true, 0);
+                                }
                             }
                         }
-                    }
-
-                    for (int i = 0; i < MAX_BASES; i++)
-                    {
-                        BaseInstance tempBase = state->base_manager->bases[i];
-                        if (tempBase.team != state->team)
+                        else if (hits[h].kind == SPATIAL_KIND_BASE)
                         {
-                            if (SDL_PointInRectFloat(&attack->position, &tempBase.rect))
+                            BaseInstance tempBase = state->base_manager->bases[i];
+                            if (tempBase.team != state->team)
                             {
-                                SDL_Log("Attack Hit Base %d", i);
-                                damageBase(state, i, PLAYER_ATTACK_DAMAGE_VALUE, true);
+                                if (SDL_PointInRectFloat(&attack->position, &tempBase.rect))
+                                {
+                                    SDL_Log("Attack Hit Base %d", i);
+                                    damageBase(state, i, PLAYER_ATTACK_DAMAGE_VALUE, true);
+                                }
                             }
                         }
-                    }
-
-                    for (int i = 0; i < MINION_MAX_AMOUNT; i++)
-                    {
-                        MinionData minion = state->minion_manager->minions[i];
-                        SDL_FRect minionRect = {minion.position.x, minion.position.y, MINION_WIDTH, MINION_HEIGHT};
-                        SDL_FRect attackRect = {attack->position.x, attack->position.y, attack->render_width, attack->render_height};
+                        else if (hits[h].kind == SPATIAL_KIND_MINION)
+                        {
+                            MinionData minion = state->minion_manager->minions[i];
+                            SDL_FRect minionRect = {minion.position.x, minion.position.y, MINION_WIDTH, MINION_HEIGHT};
 
-                        if (!minion.active)
-                            continue;
+                            if (!minion.active)
+                                continue;
 
-                        if (minion.team != state->team)
-                        {
-                            if (SDL_HasRectIntersectionFloat(&attackRect, &minionRect))
+                            if (minion.team != state->team)
                             {
-                                if (state->sync_clock - minion.attack_cooldown_timer > 500)
+                                if (SDL_HasRectIntersectionFloat(&attackRect, &minionRect))
                                 {
-                                    damageMinion(*state, i, PLAYER_ATTACK_DAMAGE_VALUE, true, 0);
-                                    attack_cooldown = state->sync_clock;
+                                    if (state->sync_clock - minion.attack_cooldown_timer > 500)
+                                    {
+                                        damageMinion(*state, i, PLAYER_ATTACK_DAMAGE_VALUE, true, 0);
+                                        state->attack_manager->minion_hit_time = state->sync_clock;
+                                    }
                                 }
                             }
                         }
-                    }
-
-                    for (int i = 0; i < MAX_CLIENTS; i++)
-                    {
-                        if (state->player_manager->players[i].active)
+                        else if (hits[h].kind == SPATIAL_KIND_PLAYER)
                         {
-                            PlayerInstance tempPlayer = state->player_manager->players[i];
-                            if (tempPlayer.team != state->team)
+                            if (state->player_manager->players[i].active)
                             {
-                                if (SDL_PointInRectFloat(&attack->position, &tempPlayer.rect))
+                                PlayerInstance tempPlayer = state->player_manager->players[i];
+                                if (tempPlayer.team != state->team)
                                 {
-                                    SDL_Log("Attack Hit Player %d", i);
-                                    damagePlayer(*state, i, PLAYER_ATTACK_DAMAGE_VALUE, true);
+                                    if (SDL_PointInRectFloat(&attack->position, &tempPlayer.rect))
+                                    {
+                                        SDL_Log("Attack Hit Player %d", i);
+                                        damagePlayer(*state, i, PLAYER_ATTACK_DAMAGE_VALUE, true);
+                                    }
                                 }
                             }
                         }
@@ -202,26 +224,31 @@ static void update_single_attack(AttackInstance *attack, AppState *state)
             }
             else if (attack->attacker == OBJECT_TYPE_TOWER)
             {
-                for (int i = 0; i < MAX_CLIENTS; i++)
+                // Players were always resolved before minions; hits are sorted by kind, so walk them twice
+                for (int h = 0; h < hit_count; h++)
                 {
-                    if (state->player_manager->players[i].active)
+                    int i = hits[h].index;
+                    if (hits[h].kind != SPATIAL_KIND_PLAYER || !state->player_manager->players[i].active)
+                        continue;
+
+                    PlayerInstance tempPlayer = state->player_manager->players[i];
+                    if (tempPlayer.team != state->tower_manager->towers[attack->owner_id].team)
                     {
-                        PlayerInstance tempPlayer = state->player_manager->players[i];
-                        if (tempPlayer.team != state->tower_manager->towers[attack->owner_id].team)
+                        if (SDL_PointInRectFloat(&attack->position, &tempPlayer.rect))
                         {
-                            if (SDL_PointInRectFloat(&attack->position, &tempPlayer.rect))
-                            {
-                                SDL_Log("Attack Hit Player %d", i);
-                                damagePlayer(*state, i, TOWER_ATTACK_DAMAGE_VALUE, true);
-                            }
+                            SDL_Log("Attack Hit Player %d", i);
+                            damagePlayer(*state, i, TOWER_ATTACK_DAMAGE_VALUE, true);
                         }
                     }
                 }
-                for (int i = 0; i < MINION_MAX_AMOUNT; i++)
+                for (int h = 0; h < hit_count; h++)
                 {
+                    int i = hits[h].index;
+                    if (hits[h].kind != SPATIAL_KIND_MINION)
+                        continue;
+
                     MinionData minion = state->minion_manager->minions[i];
                     SDL_FRect minionRect = {minion.position.x, minion.position.y, MINION_WIDTH, MINION_HEIGHT};
-                    SDL_FRect attackRect = {attack->position.x, attack->position.y, attack->render_width, attack->render_height};
 
                     if (!minion.active)
                         continue;
@@ -230,10 +257,10 @@ static void update_single_attack(AttackInstance *attack, AppState *state)
                     {
                         if (SDL_HasRectIntersectionFloat(&attackRect, &minionRect))
                         {
-                            if (state->sync_clock - attack_cooldown > 1000)
+                            if (state->sync_clock - state->attack_manager->minion_hit_time > 1000)
                             {
                                 damageMinion(*state, i, PLAYER_ATTACK_DAMAGE_VALUE, true, 0);
-                                attack_cooldown = state->sync_clock;
+                                state->attack_manager->minion_hit_time = state->sync_clock;
                             }
                         }
                     }
@@ -253,7 +280,7 @@ static void update_single_attack(AttackInstance *attack, AppState *state)
  */
 static void render_single_attack(const AttackInstance *attack, AppState *state)
 {
-    if (!attack || !attack->active || !attack->texture || !state || !state->renderer || !state->camera_state)
+    if (!attack || !attack->active || !attack->sprite || !state || !state->renderer || !state->camera_state)
     {
         return;
     }
@@ -263,18 +290,18 @@ static void render_single_attack(const AttackInstance *attack, AppState *state)
     float cam_y = Camera_GetY(camera);
 
     SDL_FRect dst_rect = {
-        .x = attack->position.x - cam_x - attack->render_width / 2.0f,
-        .y = attack->position.y - cam_y - attack->render_height / 2.0f,
+        .x = LERP(attack->prev_position.x, attack->position.x, state->render_alpha) - cam_x - attack->render_width / 2.0f,
+        .y = LERP(attack->prev_position.y, attack->position.y, state->render_alpha) - cam_y - attack->render_height / 2.0f,
         .w = attack->render_width,
         .h = attack->render_height};
 
-    SDL_RenderTextureRotated(state->renderer,
-                             attack->texture,
-                             &attack->sprite_portion,
-                             &dst_rect,
-                             attack->angle_deg,
-                             NULL,
-                             SDL_FLIP_NONE);
+    SpriteBatch_DrawRegion(state->sprite_batch,
+                           attack->sprite,
+                           &attack->sprite_portion,
+                           &dst_rect,
+                           attack->angle_deg,
+                           SDL_FLIP_NONE,
+                           SPRITE_DEPTH_ATTACKS);
 }
 
 // --- Static Callback Functions (for EntityManager) ---
@@ -330,28 +357,6 @@ static void Internal_AttackManagerRender(AttackManager am, AppState *state)
     }
 }
 
-/**
- * @brief Internal function to clean up AttackManager resources.
- * @param am The AttackManager instance.
- */
-static void Internal_AttackManagerCleanup(AttackManager am)
-{
-    if (!am)
-        return;
-    SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "Cleaning up AttackManager resources...");
-    if (am->fireball_texture)
-    {
-        SDL_DestroyTexture(am->fireball_texture);
-        am->fireball_texture = NULL;
-    }
-
-    if (am->lightning_arrow_texture)
-    {
-        SDL_DestroyTexture(am->lightning_arrow_texture);
-        am->lightning_arrow_texture = NULL;
-    }
-}
-
 /**
  * @brief Wrapper function conforming to EntityFunctions.update signature.
  * @param manager The EntityManager instance (unused).
@@ -382,7 +387,7 @@ static void attack_manager_render_callback(EntityManager manager, AppState *stat
 static void attack_manager_cleanup_callback(EntityManager manager, AppState *state)
 {
     (void)manager;
-    Internal_AttackManagerCleanup(state ? state->attack_manager : NULL);
+    // Sprites belong to the texture atlas, so there is nothing to release here
     if (state)
     {
         state->attack_manager = NULL;
@@ -393,16 +398,16 @@ static void attack_manager_cleanup_callback(EntityManager manager, AppState *sta
 
 /**
  * @brief Initializes the AttackManager module and registers its entity functions.
- * Loads resources for known attack types.
+ * Looks up the sprites for known attack types.
  * @param state Pointer to the main AppState.
  * @return A new AttackManager instance on success, NULL on failure (use SDL_GetError()).
  * @sa AttackManager_Destroy
  */
 AttackManager AttackManager_Init(AppState *state)
 {
-    if (!state || !state->renderer || !state->entity_manager)
+    if (!state || !state->entity_manager)
     {
-        SDL_SetError("Invalid AppState or missing renderer/entity_manager for AttackManager_Init");
+        SDL_SetError("Invalid AppState or missing entity_manager for AttackManager_Init");
         return NULL;
     }
 
@@ -414,27 +419,12 @@ AttackManager AttackManager_Init(AppState *state)
     }
     am->active_attack_count = 0;
     am->next_attack_id = 1;
+    // The pool is allocated on the first spawn; clients adopt the server's limit on S_WELCOME
+    am->max_attacks = state->max_attacks > 0 ? state->max_attacks : ATTACK_DEFAULT_MAX;
 
-    // --- Load Resources ---
-    const char fireball_path[] = "./resources/Sprites/Red_Team/Fire_Wizard/Fireball_Charge.png";
-    am->fireball_texture = IMG_LoadTexture(state->renderer, fireball_path);
-    if (!am->fireball_texture)
-    {
-        SDL_LogError(SDL_LOG_CATEGORY_ERROR, "[Attack Init] Failed load texture '%s': %s", fireball_path, SDL_GetError());
-        SDL_free(am);
-        return NULL;
-    }
-    SDL_SetTextureScaleMode(am->fireball_texture, SDL_SCALEMODE_NEAREST);
-
-    const char lightning_arrow_path[] = "./resources/Sprites/Blue_Team/Lightning_Wizard/Lightning_Arrow_Charge.png";
-    am->lightning_arrow_texture = IMG_LoadTexture(state->renderer, lightning_arrow_path);
-    if (!am->lightning_arrow_texture)
-    {
-        SDL_LogError(SDL_LOG_CATEGORY_ERROR, "[Attack Init] Failed load texture '%s': %s", lightning_arrow_path, SDL_GetError());
-        SDL_free(am);
-        return NULL;
-    }
-    SDL_SetTextureScaleMode(am->lightning_arrow_texture, SDL_SCALEMODE_NEAREST);
+    // --- Look Up Sprites (NULL without a renderer, e.g. on a dedicated server) ---
+    am->fireball_sprite = TextureAtlas_Get(state->texture_atlas, ATLAS_SPRITE_FIREBALL);
+    am->lightning_arrow_sprite = TextureAtlas_Get(state->texture_atlas, ATLAS_SPRITE_LIGHTNING_ARROW);
 
     // --- Register with EntityManager ---
     EntityFunctions attack_funcs = {
@@ -447,7 +437,6 @@ AttackManager AttackManager_Init(AppState *state)
     if (!EntityManager_Add(state->entity_manager, &attack_funcs))
     {
         SDL_LogError(SDL_LOG_CATEGORY_ERROR, "[Attack Init] Failed to add entity to manager: %s", SDL_GetError());
-        Internal_AttackManagerCleanup(am);
         SDL_free(am);
         return NULL;
     }
@@ -466,18 +455,20 @@ void AttackManager_Destroy(AttackManager am)
 {
     if (am)
     {
-        am->fireball_texture = NULL;
-        SDL_free(am);
-        SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "AttackManager state container destroyed.");
-    }
-    if (am)
-    {
-        am->lightning_arrow_texture = NULL;
+        SDL_free(am->attacks);
         SDL_free(am);
         SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "AttackManager state container destroyed.");
     }
 }
 
+void AttackManager_SetMaxAttacks(AttackManager am, int max_attacks)
+{
+    if (!am || max_attacks <= 0)
+        return;
+    am->max_attacks = max_attacks;
+    SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "AttackManager limit set to %d attacks.", max_attacks);
+}
+
 /**
  * @brief Handles a spawn message received from the server for a new attack instance.
  * Finds an available slot and initializes the attack based on the received data.
@@ -503,6 +494,7 @@ void AttackManager_HandleServerSpawn(AttackManager am, const Msg_ServerSpawnAtta
     attack->type = (AttackType)data->attack_type;
     attack->owner_id = data->owner_id;
     attack->position = data->start_pos;
+    attack->prev_position = data->start_pos;
     attack->target = data->target_pos;
     attack->velocity = data->velocity;
     attack->attacker = data->attacker;
@@ -513,13 +505,8 @@ void AttackManager_HandleServerSpawn(AttackManager am, const Msg_ServerSpawnAtta
     // {
     // case OBJECT_TYPE_PLAYER:
 
-    attack->texture = attack->team ? am->fireball_texture : am->lightning_arrow_texture;
-    if (!attack->texture)
-    {
-        SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "Attack texture missing for attack %u", attack->id);
-        attack->active = false;
-        return;
-    }
+    // NULL on a dedicated server; the attack is still simulated, just never drawn
+    attack->sprite = attack->team ? am->fireball_sprite : am->lightning_arrow_sprite;
     attack->render_width = PLAYER_ATTACK_RENDER_WIDTH;
     attack->render_height = PLAYER_ATTACK_RENDER_HEIGHT;
     attack->hit_range = PLAYER_ATTACK_HIT_RANGE;
@@ -611,7 +598,12 @@ void AttackManager_HandleClientSpawnRequest(AttackManager am, AppState *state, u
     spawn_msg.team = data.team;
 
     // --- 6. Broadcast via NetServer ---
-    NetServer_BroadcastMessage(state->net_server_state, &spawn_msg, sizeof(Msg_ServerSpawnAttackData), -1);
+    Uint8 encoded[NET_CODEC_MAX_MESSAGE_SIZE];
+    int encoded_length = NetCodec_EncodeServerSpawnAttack(&spawn_msg, encoded, sizeof(encoded));
+    if (encoded_length > 0)
+    {
+        NetServer_BroadcastMessage(state->net_server_state, encoded, encoded_length, -1);
+    }
 
     SDL_LogDebug(SDL_LOG_CATEGORY_APPLICATION, "[Attack Handle Req] Client %u requested spawn type %u, broadcasting attack ID %u", (unsigned int)owner_id, (unsigned int)data.attack_type, new_attack_id);
 
@@ -695,7 +687,12 @@ void AttackManager_ServerSpawnTowerAttack(AttackManager am, AppState *state, Att
     spawn_msg.team = firingTower->team;
 
     // --- 6. Broadcast via NetServer ---
-    NetServer_BroadcastMessage(state->net_server_state, &spawn_msg, sizeof(Msg_ServerSpawnAttackData), -1);
+    Uint8 encoded[NET_CODEC_MAX_MESSAGE_SIZE];
+    int encoded_length = NetCodec_EncodeServerSpawnAttack(&spawn_msg, encoded, sizeof(encoded));
+    if (encoded_length > 0)
+    {
+        NetServer_BroadcastMessage(state->net_server_state, encoded, encoded_length, -1);
+    }
 
     SDL_LogDebug(SDL_LOG_CATEGORY_APPLICATION, "[Attack Spawn Tower] Broadcasting attack ID %u from tower %d", new_attack_id, towerIndex);
 
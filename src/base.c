@@ -9,7 +9,7 @@
  */
 static void render_single_base(const BaseInstance *base, AppState *state)
 {
-  if (!base || !base->texture || !state || !state->renderer || !state->camera_state)
+  if (!base || !base->sprite || !state || !state->renderer || !state->camera_state)
   {
     return;
   }
@@ -28,17 +28,14 @@ static void render_single_base(const BaseInstance *base, AppState *state)
       .w = BASE_RENDER_WIDTH,
       .h = BASE_RENDER_HEIGHT};
 
-  SDL_RenderTexture(state->renderer, base->texture, NULL, &dst_rect);
+  SpriteBatch_DrawRegion(state->sprite_batch, base->sprite, NULL, &dst_rect, 0.0, SDL_FLIP_NONE, SPRITE_DEPTH_BUILDINGS);
 
   char text_buffer[16];
   snprintf(text_buffer, sizeof(text_buffer), "%d/%d", base->current_health, BASE_HEALTH_MAX);
 
-  char base_name[32];
-  snprintf(base_name, sizeof(base_name), "base_%d_health_value", base->index);
-
   SDL_Color team_color = base->team ? (SDL_Color){255, 0, 0, 255} : (SDL_Color){0, 0, 255, 255};
 
-  update_hud_instance(state, get_hud_index_by_name(state, base_name), text_buffer,
+  update_hud_instance(state, base->hud_handle, text_buffer,
                       team_color, (SDL_FPoint){baseX, baseY - 50}, 0);
 }
 
@@ -57,27 +54,6 @@ static void Internal_BaseManagerRender(BaseManagerState bm_state, AppState *stat
   render_single_base(&bm_state->bases[1], state); // Render Blue Base
 }
 
-/**
- * @brief Internal function to clean up BaseManager resources.
- * @param bm_state The internal state of the base manager module.
- */
-static void Internal_BaseManagerCleanup(BaseManagerState bm_state)
-{
-  if (!bm_state)
-    return;
-  SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "Cleaning up BaseManager resources...");
-  if (bm_state->red_texture)
-  {
-    SDL_DestroyTexture(bm_state->red_texture);
-    bm_state->red_texture = NULL;
-  }
-  if (bm_state->blue_texture)
-  {
-    SDL_DestroyTexture(bm_state->blue_texture);
-    bm_state->blue_texture = NULL;
-  }
-}
-
 /**
  * @brief Wrapper function conforming to EntityFunctions.render signature.
  * @param manager The EntityManager instance.
@@ -97,7 +73,7 @@ static void base_manager_render_callback(EntityManager manager, AppState *state)
 static void base_manager_cleanup_callback(EntityManager manager, AppState *state)
 {
   (void)manager; // Manager instance is not used in this specific implementation
-  Internal_BaseManagerCleanup(state ? state->base_manager : NULL);
+  // Sprites belong to the texture atlas, so there is nothing to release here
   if (state)
   {
     state->base_manager = NULL; // Indicate cleanup happened
@@ -108,13 +84,13 @@ static void base_manager_cleanup_callback(EntityManager manager, AppState *state
 
 BaseManagerState BaseManager_Init(AppState *state)
 {
-  if (!state || !state->renderer || !state->entity_manager)
+  if (!state || !state->entity_manager)
   {
-    SDL_SetError("Invalid AppState or missing renderer/entity_manager for BaseManager_Init");
+    SDL_SetError("Invalid AppState or missing entity_manager for BaseManager_Init");
     return NULL;
   }
 
-  // --- Allocation and Resource Loading ---
+  // --- Allocation ---
   BaseManagerState bm_state = (BaseManagerState)SDL_calloc(1, sizeof(struct BaseManagerState_s));
   if (!bm_state)
   {
@@ -122,40 +98,12 @@ BaseManagerState BaseManager_Init(AppState *state)
     return NULL;
   }
 
-  bm_state->red_texture = IMG_LoadTexture(state->renderer, RED_BASE_PATH);
-  if (!bm_state->red_texture)
-  {
-    SDL_LogError(SDL_LOG_CATEGORY_ERROR, "[Base Init] Failed load texture '%s': %s", RED_BASE_PATH, SDL_GetError());
-    SDL_free(bm_state);
-    return NULL;
-  }
-  SDL_SetTextureScaleMode(bm_state->red_texture, SDL_SCALEMODE_NEAREST);
-
-  bm_state->blue_texture = IMG_LoadTexture(state->renderer, BLUE_BASE_PATH);
-  if (!bm_state->blue_texture)
-  {
-    SDL_LogError(SDL_LOG_CATEGORY_ERROR, "[Base Init] Failed load texture '%s': %s", BLUE_BASE_PATH, SDL_GetError());
-    SDL_DestroyTexture(bm_state->red_texture); // Clean up already loaded texture
-    SDL_free(bm_state);
-    return NULL;
-  }
-  SDL_SetTextureScaleMode(bm_state->blue_texture, SDL_SCALEMODE_NEAREST);
-
-  bm_state->destroyed_texture = IMG_LoadTexture(state->renderer, DESTROYED_BASE_PATH);
-  if (!bm_state->destroyed_texture)
-  {
-    SDL_LogError(SDL_LOG_CATEGORY_ERROR, "[Base Init] Failed load texture '%s': %s", DESTROYED_BASE_PATH, SDL_GetError());
-    SDL_DestroyTexture(bm_state->red_texture); // Clean up already loaded texture
-    SDL_free(bm_state);
-    return NULL;
-  }
-  SDL_SetTextureScaleMode(bm_state->destroyed_texture, SDL_SCALEMODE_NEAREST);
-
   for (int i = 0; i < MAX_BASES; i++)
   {
     // --- Initialize Base Instances ---
     bm_state->bases[i].position = (SDL_FPoint){(i ? BASE_RED_POS_X : BASE_BLUE_POS_X), BUILDINGS_POS_Y};
-    bm_state->bases[i].texture = i ? bm_state->red_texture : bm_state->blue_texture;
+    // NULL without a renderer (dedicated server)
+    bm_state->bases[i].sprite = TextureAtlas_Get(state->texture_atlas, i ? ATLAS_SPRITE_BASE_RED : ATLAS_SPRITE_BASE_BLUE);
     bm_state->bases[i].current_health = BASE_HEALTH_MAX;
     bm_state->bases[i].rect = (SDL_FRect){(i ? BASE_RED_POS_X : BASE_BLUE_POS_X) - BASE_RENDER_WIDTH / 2.0f, BUILDINGS_POS_Y - BASE_RENDER_HEIGHT / 2.0f, BASE_RENDER_WIDTH, BASE_RENDER_HEIGHT};
     bm_state->bases[i].team = i;
@@ -165,7 +113,7 @@ BaseManagerState BaseManager_Init(AppState *state)
     char base_name[32];
     snprintf(base_name, sizeof(base_name), "base_%d_health_value", i);
 
-    create_hud_instance(state, get_hud_element_count(state->HUD_manager), base_name, true);
+    bm_state->bases[i].hud_handle = create_hud_instance(state, base_name, true);
   }
 
   // --- Register with EntityManager ---
@@ -179,7 +127,6 @@ BaseManagerState BaseManager_Init(AppState *state)
   if (!EntityManager_Add(state->entity_manager, &base_funcs))
   {
     SDL_LogError(SDL_LOG_CATEGORY_ERROR, "[Base Init] Failed to add entity to manager: %s", SDL_GetError());
-    Internal_BaseManagerCleanup(bm_state); // Cleanup loaded textures
     SDL_free(bm_state);
     return NULL;
   }
@@ -190,12 +137,8 @@ BaseManagerState BaseManager_Init(AppState *state)
 
 void BaseManager_Destroy(BaseManagerState bm_state)
 {
-  // Cleanup callback handles texture destruction.
   if (bm_state)
   {
-    // Prevent dangling pointers after cleanup callback potentially ran via EntityManager
-    bm_state->red_texture = NULL;
-    bm_state->blue_texture = NULL;
     SDL_free(bm_state);
     SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "BaseManagerState container destroyed.");
   }
@@ -219,7 +162,7 @@ void damageBase(AppState *state, int baseIndex, float damageValue, bool sendToSe
 
   if (tempBase->current_health <= 0)
   {
-    tempBase->texture = state->base_manager->destroyed_texture;
+    tempBase->sprite = TextureAtlas_Get(state->texture_atlas, ATLAS_SPRITE_BASE_DESTROYED);
 
     if (sendToServer)
     {
@@ -31,7 +31,7 @@ static void Internal_CameraRenderImplementation(CameraState camera_state, AppSta
   MapState map_state = state->map_state;
 
   SDL_FPoint player_pos;
-  if (PlayerManager_GetLocalPlayerPosition(player_mgr, &player_pos))
+  if (PlayerManager_GetLocalPlayerRenderPosition(player_mgr, state->render_alpha, &player_pos))
   {
     // Center the camera on the player position
     camera_state->x = player_pos.x - camera_state->w / 2.0f;
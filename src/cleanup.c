@@ -17,20 +17,30 @@ void SDL_AppQuit(void *appstate, SDL_AppResult result)
 
   // --- Destroy ADT Modules (Reverse Order of Creation from init.c) ---
   // EntityManager_Destroy calls the cleanup callbacks for all registered entities
-  // in reverse order, so we just need to destroy the manager itself last.
-  // The individual Destroy functions primarily free the manager's state struct.
+  // in reverse order. The individual Destroy functions primarily free the manager's state struct;
+  // these modules' callbacks only forget the pointer, so their containers are freed first.
   Camera_Destroy(state->camera_state);
+  state->camera_state = NULL;
   PlayerManager_Destroy(state->player_manager);
+  state->player_manager = NULL;
   AttackManager_Destroy(state->attack_manager);
+  state->attack_manager = NULL;
   TowerManager_Destroy(state->tower_manager);
+  state->tower_manager = NULL;
   BaseManager_Destroy(state->base_manager);
-  Map_Destroy(state->map_state);
+  state->base_manager = NULL;
   NetClient_Destroy(state->net_client_state);
+  state->net_client_state = NULL;
   if (state->net_server_state)
   {
     NetServer_Destroy(state->net_server_state);
+    state->net_server_state = NULL;
   }
+
+  // The map's cleanup callback releases its tilesets and chunks, so the container is freed only after it ran
+  MapState map_state = state->map_state;
   EntityManager_Destroy(state->entity_manager, state); // This calls the cleanup callbacks
+  Map_Destroy(map_state);
 
   // --- Destroy Core SDL Resources ---
   if (state->renderer)
@@ -56,7 +66,7 @@ void SDL_AppQuit(void *appstate, SDL_AppResult result)
 
   // --- Quit SDL Subsystems ---
   SDLNet_Quit();
-  SDL_QuitSubSystem(SDL_INIT_VIDEO);
+  SDL_QuitSubSystem(state->is_dedicated ? SDL_INIT_EVENTS : SDL_INIT_VIDEO);
 
   // --- Free AppState ---
   SDL_free(state);
@@ -12,6 +12,25 @@ struct EntityManager_s
     int capacity;              /**< Max number of entities the array can hold. */
 };
 
+// --- Static Helper Functions ---
+
+/**
+ * @brief Checks whether an entity's per-frame update callbacks should run in the current game state.
+ * Outside of PLAYING only the HUD, the network modules and the asset loader keep ticking.
+ * @param entity The entity definition to check.
+ * @param state Pointer to the main AppState.
+ * @return True if the entity should be updated this frame.
+ */
+static bool entity_updates_in_state(const EntityFunctions *entity, const AppState *state)
+{
+    return state->currentGameState == GAME_STATE_PLAYING ||
+           !strcmp(entity->name, "HUD_manager") ||
+           !strcmp(entity->name, "net_client") ||
+           !strcmp(entity->name, "net_server") ||
+           !strcmp(entity->name, "room_host") ||
+           !strcmp(entity->name, "asset_loader");
+}
+
 // --- Public API Function Implementations ---
 
 EntityManager EntityManager_Create(int max_entities)
@@ -133,15 +152,18 @@ void EntityManager_UpdateAll(EntityManager manager, AppState *state)
 
     for (int i = 0; i < manager->count; ++i)
     {
-        if (manager->entities[i].update)
+        if (manager->entities[i].update && entity_updates_in_state(&manager->entities[i], state))
         {
-            if (state->currentGameState == GAME_STATE_PLAYING ||
-                !strcmp(manager->entities[i].name, "HUD_manager") ||
-                !strcmp(manager->entities[i].name, "net_client") ||
-                !strcmp(manager->entities[i].name, "net_server"))
-            {
-                manager->entities[i].update(manager, state);
-            }
+            manager->entities[i].update(manager, state);
+        }
+    }
+
+    // Second pass once every entity has produced its output for this frame
+    for (int i = 0; i < manager->count; ++i)
+    {
+        if (manager->entities[i].late_update && entity_updates_in_state(&manager->entities[i], state))
+        {
+            manager->entities[i].late_update(manager, state);
         }
     }
 }
@@ -1,4 +1,5 @@
 #include "../include/hud.h"
+#include "../include/asset_loader.h"
 
 // --- Internal Structures ---
 
@@ -10,9 +11,10 @@ typedef struct HUDInstance
     char name[64];
     bool visible;          /**< Whether this text element is currently visible. */
     char text_buffer[256]; /**< The actual string of text to display. */
-    SDL_Texture *texture;  /**< The SDL_Texture holding the rendered text image. */
+    TTF_Text *text;        /**< Laid-out text drawn from the shared glyph atlas, created on first update. */
     SDL_FRect rect;        /**< The position (x,y) and dimensions (w,h) on screen. */
     SDL_Color color;       /**< The color of the text. */
+    FontSize font_size;    /**< The font the text was laid out with. */
     bool changeable;       /**< True if text_buffer changed and texture needs regeneration. */
 } HUDInstance;
 
@@ -25,74 +27,113 @@ struct HUDManager_s
     int elementCount;
     TTF_Font *fontDefault;
     TTF_Font *fontSmall;
+    TTF_TextEngine *text_engine; /**< Rasterizes each glyph once into an atlas texture shared by all elements. */
+    int name_index[HUD_NAME_INDEX_SIZE]; /**< Open-addressing hash of element names; holds element index + 1, 0 if empty. */
 };
 
+// --- Static Helper Functions ---
+
+/**
+ * @brief Hashes an element name (FNV-1a).
+ * @param name The element name.
+ * @return The 32-bit hash.
+ */
+static Uint32 hash_name(const char *name)
+{
+    Uint32 hash = 2166136261u;
+    for (const unsigned char *c = (const unsigned char *)name; *c; ++c)
+    {
+        hash ^= *c;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+/**
+ * @brief Finds the name index slot holding the given name, or the empty slot where it belongs.
+ * The index is sized well above HUD_MAX_ELEMENTS_AMOUNT, so an empty slot always exists.
+ * @param hm The HUDManager instance.
+ * @param name The element name.
+ * @return A slot in name_index.
+ */
+static int find_name_slot(HUDManager hm, const char *name)
+{
+    int slot = (int)(hash_name(name) & (HUD_NAME_INDEX_SIZE - 1));
+    while (hm->name_index[slot] && strcmp(hm->elements[hm->name_index[slot] - 1].name, name) != 0)
+    {
+        slot = (slot + 1) & (HUD_NAME_INDEX_SIZE - 1); // Linear probing
+    }
+    return slot;
+}
+
 void hud_finish_msg(AppState *state)
 {
+    if (!state || !state->HUD_manager)
+        return;
+
     for (int i = 0; i < HUD_MAX_ELEMENTS_AMOUNT; i++)
     {
         state->HUD_manager->elements[i].visible = false;
     }
-    create_hud_instance(state, get_hud_element_count(state->HUD_manager), "game_finished_msg", false);
+    int handle = create_hud_instance(state, "game_finished_msg", false);
 
     char text_buffer[32];
     snprintf(text_buffer, sizeof(text_buffer), "Team: %s has won the game!", state->winningTeam ? "red" : "blue");
 
     SDL_Color team_color = state->winningTeam ? (SDL_Color){255, 0, 0, 255} : (SDL_Color){0, 0, 255, 255};
 
-    update_hud_instance(state, get_hud_index_by_name(state, "game_finished_msg"), text_buffer, team_color, (SDL_FPoint){0.0f, 0.0f}, 0);
+    update_hud_instance(state, handle, text_buffer, team_color, (SDL_FPoint){0.0f, 0.0f}, 0);
 }
 
 int get_hud_element_count(HUDManager hm)
 {
-    return hm->elementCount;
+    return hm ? hm->elementCount : 0;
 }
 
-int get_hud_index_by_name(AppState *state, char name[])
+int get_hud_index_by_name(AppState *state, const char name[])
 {
-    for (int i = 0; i < state->HUD_manager->elementCount; i++)
-    {
-        if (!strcmp(state->HUD_manager->elements[i].name, name))
-        {
-            return i;
-        }
-    }
-    return -1;
+    if (!state || !state->HUD_manager || !name)
+        return -1; // No HUD on a dedicated server
+
+    HUDManager hm = state->HUD_manager;
+    int slot = find_name_slot(hm, name);
+    return hm->name_index[slot] - 1; // Empty slots hold 0, so this yields -1 for unknown names
 }
 
-void create_hud_instance(AppState *state, int index, char name[], bool changeable)
+int create_hud_instance(AppState *state, const char name[], bool changeable)
 {
     HUDManager hm = state ? state->HUD_manager : NULL;
     // Ensure local HUD exists and required managers are available.
-    if (!hm || !state)
+    if (!hm || !state || !name)
     {
-        return;
+        return -1;
     }
 
-    bool existingElement = false;
-    for (int i = 0; i < HUD_MAX_ELEMENTS_AMOUNT; i++)
+    int slot = find_name_slot(hm, name);
+    if (hm->name_index[slot])
     {
-        if (!strcmp(hm->elements[i].name, name))
-        {
-            existingElement = true;
-            // SDL_Log("elementCount:%d", hm->elementCount);
-        }
+        return hm->name_index[slot] - 1; // Already registered, hand out the same handle
     }
-    if (!existingElement)
+
+    if (hm->elementCount >= HUD_MAX_ELEMENTS_AMOUNT)
     {
-        hm->elementCount++;
+        SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[HUD] No free element for '%s'.", name);
+        return -1;
     }
 
-    HUDInstance *currentElement = &state->HUD_manager->elements[index];
-    strcpy(currentElement->name, name);
+    int index = hm->elementCount++;
+    HUDInstance *currentElement = &hm->elements[index];
+    SDL_strlcpy(currentElement->name, name, sizeof(currentElement->name));
     currentElement->changeable = changeable;
+    hm->name_index[slot] = index + 1;
+    return index;
 }
 
 void update_hud_instance(AppState *state, int index, char text_buffer[], SDL_Color color, SDL_FPoint dest_point, FontSize fontSize)
 {
     HUDManager hm = state ? state->HUD_manager : NULL;
     // Ensure local HUD exists and required managers are available.
-    if (!hm || !state)
+    if (!hm || !state || index < 0 || index >= hm->elementCount)
     {
         return;
     }
@@ -101,10 +142,45 @@ void update_hud_instance(AppState *state, int index, char text_buffer[], SDL_Col
 
     if (strlen(text_buffer) >= 1)
     {
+        // Labels are refreshed every frame to follow their owner; only a change of content needs a new layout
+        bool unchanged = currentElement->text && currentElement->font_size == fontSize &&
+                         currentElement->color.r == color.r && currentElement->color.g == color.g &&
+                         currentElement->color.b == color.b && currentElement->color.a == color.a &&
+                         strcmp(currentElement->text_buffer, text_buffer) == 0;
+        if (unchanged)
+        {
+            currentElement->rect.x = dest_point.x;
+            currentElement->rect.y = dest_point.y;
+            currentElement->visible = true;
+            return;
+        }
+
         TTF_Font *currentFont = fontSize ? state->HUD_manager->fontSmall : state->HUD_manager->fontDefault;
-        SDL_Surface *textSurface = TTF_RenderText_Blended(currentFont, text_buffer, strlen(text_buffer), color);
-        currentElement->texture = SDL_CreateTextureFromSurface(state->renderer, textSurface);
-        currentElement->rect = (SDL_FRect){dest_point.x, dest_point.y, (float)textSurface->w, (float)textSurface->h};
+        // Reuse the element's text object; only its string, font and color change between updates
+        if (!currentElement->text)
+        {
+            currentElement->text = TTF_CreateText(hm->text_engine, currentFont, text_buffer, 0);
+            if (!currentElement->text)
+            {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "[HUD] Failed to create text for '%s': %s", currentElement->name, SDL_GetError());
+                currentElement->visible = false;
+                return;
+            }
+        }
+        else
+        {
+            TTF_SetTextFont(currentElement->text, currentFont);
+            TTF_SetTextString(currentElement->text, text_buffer, 0);
+        }
+        TTF_SetTextColor(currentElement->text, color.r, color.g, color.b, color.a);
+        SDL_strlcpy(currentElement->text_buffer, text_buffer, sizeof(currentElement->text_buffer));
+        currentElement->color = color;
+        currentElement->font_size = fontSize;
+
+        int text_w = 0;
+        int text_h = 0;
+        TTF_GetTextSize(currentElement->text, &text_w, &text_h);
+        currentElement->rect = (SDL_FRect){dest_point.x, dest_point.y, (float)text_w, (float)text_h};
         currentElement->visible = true;
     }
     else
@@ -144,20 +220,16 @@ static void HUD_manager_event_callback(EntityManager manager, AppState *state, S
             if (event->key.scancode == SDL_SCANCODE_RETURN || event->key.scancode == SDL_SCANCODE_KP_ENTER)
             {
                 // Process the command when Enter is pressed
-                if (strcmp(command_input_buffer, "start") == 0)
+                if (strcmp(command_input_buffer, "start") == 0 && !AssetLoader_IsDone(state->asset_loader))
+                {
+                    // Every peer has to be able to draw the match before it begins
+                    SDL_Log("Host: Assets are still loading. Type 'start' again once loading is done.");
+                }
+                else if (strcmp(command_input_buffer, "start") == 0)
                 {
                     SDL_Log("Host selected 'start'. Transitioning to GAME_STATE_PLAYING.");
-                    state->currentGameState = GAME_STATE_PLAYING;
                     SDL_StopTextInput(state->window);
-
-                    // Broadcast MSG_TYPE_S_GAME_START to all clients
-                    if (state->net_server_state)
-                    {
-                        Msg_GameStart msg;
-                        msg.message_type = MSG_TYPE_S_GAME_START;
-                        msg.server_start_time_stamp = SDL_GetTicks();
-                        NetServer_BroadcastMessage(state->net_server_state, &msg, sizeof(Msg_GameStart), -1);
-                    }
+                    NetServer_StartGame(state->net_server_state, state);
                     hm->elements[get_hud_index_by_name(state, "lobby_host_msg")].visible = false;
                     hm->elements[get_hud_index_by_name(state, "lobby_host_input")].visible = false;
                 }
@@ -210,9 +282,9 @@ static void HUD_manager_render_callback(EntityManager manager, AppState *state)
 
     for (int i = 0; i < HUD_MAX_ELEMENTS_AMOUNT; i++)
     {
-        if (hm->elements[i].visible)
+        if (hm->elements[i].visible && hm->elements[i].text)
         {
-            SDL_RenderTexture(state->renderer, hm->elements[i].texture, NULL, &hm->elements[i].rect);
+            TTF_DrawRendererText(hm->elements[i].text, hm->elements[i].rect.x, hm->elements[i].rect.y);
         }
     }
 }
@@ -225,10 +297,27 @@ static void HUD_manager_render_callback(EntityManager manager, AppState *state)
 static void HUD_manager_cleanup_callback(EntityManager manager, AppState *state)
 {
     (void)manager;
-    if (!state || !state->HUD_manager || !state->renderer)
+    HUDManager hm = state ? state->HUD_manager : NULL;
+    if (!hm)
     {
         return;
     }
+
+    // Text objects reference the engine and fonts, so they go first
+    for (int i = 0; i < HUD_MAX_ELEMENTS_AMOUNT; i++)
+    {
+        if (hm->elements[i].text)
+        {
+            TTF_DestroyText(hm->elements[i].text);
+            hm->elements[i].text = NULL;
+        }
+    }
+    TTF_DestroyRendererTextEngine(hm->text_engine);
+    TTF_CloseFont(hm->fontSmall);
+    TTF_CloseFont(hm->fontDefault);
+    SDL_free(hm);
+    state->HUD_manager = NULL;
+    TTF_Quit();
 }
 
 // --- Static Helper Functions ---
@@ -276,6 +365,17 @@ HUDManager HUDManager_Init(AppState *state)
         return NULL;
     }
 
+    hm->text_engine = TTF_CreateRendererTextEngine(state->renderer);
+    if (!hm->text_engine)
+    {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "HUDManager_Init: Failed to create text engine: %s", SDL_GetError());
+        TTF_CloseFont(hm->fontSmall);
+        TTF_CloseFont(hm->fontDefault);
+        SDL_free(hm);
+        TTF_Quit();
+        return NULL;
+    }
+
     for (int i = 0; i < HUD_MAX_ELEMENTS_AMOUNT; i++)
     {
         hm->elements[i].visible = false;
@@ -292,6 +392,9 @@ HUDManager HUDManager_Init(AppState *state)
     if (!EntityManager_Add(state->entity_manager, &HUD_funcs))
     {
         SDL_LogError(SDL_LOG_CATEGORY_ERROR, "[HUD Init] Failed to add entity to manager: %s", SDL_GetError());
+        TTF_DestroyRendererTextEngine(hm->text_engine);
+        TTF_CloseFont(hm->fontSmall);
+        TTF_CloseFont(hm->fontDefault);
         SDL_free(hm);
         return NULL;
     }
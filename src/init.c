@@ -2,11 +2,50 @@
 
 // --- Static Helper Functions ---
 
+/**
+ * @brief Initialization stages of SDL_AppInit, in the order they run.
+ */
+static const char *const init_stages[] = {
+    "SDL_Init", "SDL_CreateWindow", "SDL_CreateRenderer", "SDLNet_Init", "EntityManager_Create",
+    "RoomHost_Init", "NetServer_Init", "NetClient_Init", "AssetLoader_Init", "Map_Init",
+    "TextureAtlas_Init", "HUDManager_Init", "SpatialHash_Init", "Base_Init", "Tower_Init",
+    "Attack_Init", "PlayerManager_Init", "MinionManager_Init", "Camera_Init", "SpriteBatch_Init",
+    "AssetLoader_Start"};
+
+/**
+ * @brief Finds a stage in init_stages.
+ * @param stage The stage name.
+ * @return Its position, or the number of stages if it is unknown (treated as after every stage).
+ */
+static int init_stage_index(const char *stage)
+{
+  int count = (int)SDL_arraysize(init_stages);
+  for (int i = 0; i < count; i++)
+  {
+    if (strcmp(init_stages[i], stage) == 0)
+    {
+      return i;
+    }
+  }
+  return count;
+}
+
+/**
+ * @brief Tells whether a stage completed before the failing one.
+ * @param failure_stage The stage that failed.
+ * @param stage The stage to check.
+ * @return True if stage ran, and succeeded, before failure_stage.
+ */
+static bool stage_completed(const char *failure_stage, const char *stage)
+{
+  return init_stage_index(stage) < init_stage_index(failure_stage);
+}
+
 /**
  * @brief Cleans up resources initialized *before* a failure occurred during SDL_AppInit.
  * This function is called internally by SDL_AppInit if an initialization step fails.
- * It attempts to destroy modules and subsystems in the reverse order they were created,
- * up to the point of failure.
+ * It tears modules down in the same order as SDL_AppQuit, skipping those whose stage
+ * had not completed before the point of failure.
  * @param state The main application state.
  * @param failure_stage A string identifying which initialization stage failed.
  */
@@ -14,53 +53,56 @@ static void cleanup_on_failure(AppState *state, const char *failure_stage)
 {
   SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "Initialization failed at stage '%s', cleaning up...", failure_stage);
 
-  // --- Destroy ADT Modules (Reverse Order of Creation) ---
-  // The comparisons check if the failure happened *before* the respective module's init.
-  if (strcmp(failure_stage, "Camera_Init") != 0)
+  // --- Destroy ADT Modules ---
+  // These modules' cleanup callbacks only forget the pointer, so their containers are freed first.
+  // The remaining modules are destroyed by their cleanup callbacks in EntityManager_Destroy.
+  if (stage_completed(failure_stage, "Camera_Init"))
   {
     Camera_Destroy(state->camera_state);
+    state->camera_state = NULL;
   }
-  if (strcmp(failure_stage, "PlayerManager_Init") != 0 && strcmp(failure_stage, "Camera_Init") != 0)
+  if (stage_completed(failure_stage, "PlayerManager_Init"))
   {
     PlayerManager_Destroy(state->player_manager);
+    state->player_manager = NULL;
   }
-  if (strcmp(failure_stage, "Attack_Init") != 0 && strcmp(failure_stage, "PlayerManager_Init") != 0 && strcmp(failure_stage, "Camera_Init") != 0)
+  if (stage_completed(failure_stage, "Attack_Init"))
   {
     AttackManager_Destroy(state->attack_manager);
+    state->attack_manager = NULL;
   }
-  if (strcmp(failure_stage, "Tower_Init") != 0 && strcmp(failure_stage, "Attack_Init") != 0 && strcmp(failure_stage, "PlayerManager_Init") != 0 && strcmp(failure_stage, "Camera_Init") != 0)
+  if (stage_completed(failure_stage, "Tower_Init"))
   {
     TowerManager_Destroy(state->tower_manager);
+    state->tower_manager = NULL;
   }
-  if (strcmp(failure_stage, "Base_Init") != 0 && strcmp(failure_stage, "Tower_Init") != 0 && strcmp(failure_stage, "Attack_Init") != 0 && strcmp(failure_stage, "PlayerManager_Init") != 0 && strcmp(failure_stage, "Camera_Init") != 0)
+  if (stage_completed(failure_stage, "Base_Init"))
   {
     BaseManager_Destroy(state->base_manager);
+    state->base_manager = NULL;
   }
-  if (strcmp(failure_stage, "Map_Init") != 0 && strcmp(failure_stage, "Base_Init") != 0 && strcmp(failure_stage, "Tower_Init") != 0 && strcmp(failure_stage, "Attack_Init") != 0 && strcmp(failure_stage, "PlayerManager_Init") != 0 && strcmp(failure_stage, "Camera_Init") != 0)
-  {
-    Map_Destroy(state->map_state);
-  }
-  if (strcmp(failure_stage, "NetClient_Init") != 0 && strcmp(failure_stage, "Map_Init") != 0 && strcmp(failure_stage, "Base_Init") != 0 && strcmp(failure_stage, "Tower_Init") != 0 && strcmp(failure_stage, "Attack_Init") != 0 && strcmp(failure_stage, "PlayerManager_Init") != 0 && strcmp(failure_stage, "Camera_Init") != 0)
+  if (stage_completed(failure_stage, "NetClient_Init"))
   {
     NetClient_Destroy(state->net_client_state);
+    state->net_client_state = NULL;
   }
-  if (strcmp(failure_stage, "NetClient_Init") != 0 && strcmp(failure_stage, "Map_Init") != 0 && strcmp(failure_stage, "Base_Init") != 0 && strcmp(failure_stage, "Tower_Init") != 0 && strcmp(failure_stage, "Attack_Init") != 0 && strcmp(failure_stage, "PlayerManager_Init") != 0 && strcmp(failure_stage, "Camera_Init") != 0 && strcmp(failure_stage, "MinionManager_Init") != 0)
-  {
-    MinionManager_Destroy(state->minion_manager);
-  }
-  // Only attempt server cleanup if it was supposed to be initialized and didn't fail before client init
-  if (state->is_server && state->net_server_state && strcmp(failure_stage, "NetServer_Init") != 0 && strcmp(failure_stage, "NetClient_Init") != 0 && strcmp(failure_stage, "Map_Init") != 0 && strcmp(failure_stage, "Base_Init") != 0 && strcmp(failure_stage, "Tower_Init") != 0 && strcmp(failure_stage, "Attack_Init") != 0 && strcmp(failure_stage, "PlayerManager_Init") != 0 && strcmp(failure_stage, "Camera_Init") != 0 && strcmp(failure_stage, "MinionManager_Init") != 0)
+  if (state->is_server && stage_completed(failure_stage, "NetServer_Init"))
   {
     NetServer_Destroy(state->net_server_state);
+    state->net_server_state = NULL;
   }
+
+  // The map's cleanup callback releases its tilesets and chunks, so the container is freed only after it ran
+  MapState map_state = stage_completed(failure_stage, "Map_Init") ? state->map_state : NULL;
   // Only destroy EntityManager if it was created successfully
-  if (state->entity_manager && strcmp(failure_stage, "EntityManager_Create") != 0)
+  if (state->entity_manager && stage_completed(failure_stage, "EntityManager_Create"))
   {
-    EntityManager_Destroy(state->entity_manager, state);
+    EntityManager_Destroy(state->entity_manager, state); // This calls the cleanup callbacks
   }
+  Map_Destroy(map_state);
 
   // --- SDL Subsystem Cleanup ---
-  if (strcmp(failure_stage, "SDLNet_Init") != 0)
+  if (stage_completed(failure_stage, "SDLNet_Init"))
   {
     SDLNet_Quit();
   }
@@ -68,19 +110,55 @@ static void cleanup_on_failure(AppState *state, const char *failure_stage)
     SDL_DestroyRenderer(state->renderer);
   if (state->window)
     SDL_DestroyWindow(state->window);
-  if (strcmp(failure_stage, "SDL_Init") != 0)
+  if (stage_completed(failure_stage, "SDL_Init"))
   {
-    SDL_QuitSubSystem(SDL_INIT_VIDEO);
+    SDL_QuitSubSystem(state->is_dedicated ? SDL_INIT_EVENTS : SDL_INIT_VIDEO);
   }
   SDL_free(state);
 }
 
+/**
+ * @brief AssetLoader callback that turns the decoded cursor image into the mouse cursor.
+ * The surface is kept in the AppState for the lifetime of the cursor.
+ * @param state The main application state.
+ * @param surfaces The decoded cursor image (NULL if loading failed).
+ * @param count Number of entries in surfaces (1).
+ */
+static void cursor_image_ready(AppState *state, SDL_Surface **surfaces, int count)
+{
+  if (count < 1 || !surfaces[0])
+  {
+    SDL_Log("Error: Failed to load a surface for cursor\n");
+    return;
+  }
+
+  state->cursor = SDL_CreateColorCursor(surfaces[0], 0, 0);
+  if (!state->cursor)
+  {
+    SDL_Log("Error: Failed to create a cursor: %s\n", SDL_GetError());
+    return;
+  }
+  state->cursor_surface = surfaces[0];
+  surfaces[0] = NULL; // Keep the surface, cleanup destroys it
+  SDL_SetCursor(state->cursor);
+}
+
 // --- SDL Application Callback Definitions ---
 
 SDL_AppResult SDL_AppInit(void **appstate, int argc, char **argv)
 {
   // --- Argument Parsing ---
   bool is_server_arg = true;                   // Default to server unless --client is specified
+  bool dedicated_arg = false;                  // Headless server without a local player
+  int start_players_arg = DEDICATED_DEFAULT_START_PLAYERS;
+  int max_players_arg = DEFAULT_MAX_PLAYERS;
+  int max_minions_arg = MINION_DEFAULT_MAX;
+  int max_attacks_arg = ATTACK_DEFAULT_MAX;
+  int interpolation_delay_arg = -1;            // -1 picks the default for the instance type
+  int room_arg = 0;                            // Room a client asks for in C_HELLO
+  int rooms_arg = 0;                           // 0 runs a single match without a RoomHost
+  int fps_arg = 0;                             // 0 picks the default rate for the instance type
+  bool vsync_arg = false;                      // Let the display pace presentation instead of the timer
   bool team_arg = BLUE_TEAM;                   // Default team
   const char *hostname_arg = DEFAULT_HOSTNAME; // Default hostname
 
@@ -90,6 +168,59 @@ SDL_AppResult SDL_AppInit(void **appstate, int argc, char **argv)
     {
       is_server_arg = false;
     }
+    else if (!strcmp(argv[i], "--dedicated"))
+    {
+      is_server_arg = true;
+      dedicated_arg = true;
+    }
+    // Hosting rooms implies a dedicated server; the process only routes and ticks them
+    else if (!strcmp(argv[i], "--rooms") && (i + 1 < argc))
+    {
+      is_server_arg = true;
+      dedicated_arg = true;
+      rooms_arg = CLAMP(SDL_atoi(argv[i + 1]), 1, ROOM_MAX_COUNT);
+      i++;
+    }
+    else if (!strcmp(argv[i], "--room") && (i + 1 < argc))
+    {
+      room_arg = CLAMP(SDL_atoi(argv[i + 1]), 0, ROOM_MAX_COUNT - 1);
+      i++;
+    }
+    else if (!strcmp(argv[i], "--players") && (i + 1 < argc))
+    {
+      start_players_arg = CLAMP(SDL_atoi(argv[i + 1]), 1, MAX_CLIENTS);
+      i++;
+    }
+    else if (!strcmp(argv[i], "--max-players") && (i + 1 < argc))
+    {
+      max_players_arg = CLAMP(SDL_atoi(argv[i + 1]), 1, MAX_CLIENTS);
+      i++;
+    }
+    // Both limits travel in S_WELCOME as 16-bit values; minions spawn in pairs
+    else if (!strcmp(argv[i], "--max-minions") && (i + 1 < argc))
+    {
+      max_minions_arg = CLAMP(SDL_atoi(argv[i + 1]), 2, UINT16_MAX);
+      i++;
+    }
+    else if (!strcmp(argv[i], "--max-attacks") && (i + 1 < argc))
+    {
+      max_attacks_arg = CLAMP(SDL_atoi(argv[i + 1]), 1, UINT16_MAX);
+      i++;
+    }
+    else if (!strcmp(argv[i], "--interp-delay") && (i + 1 < argc))
+    {
+      interpolation_delay_arg = CLAMP(SDL_atoi(argv[i + 1]), 0, 1000);
+      i++;
+    }
+    else if (!strcmp(argv[i], "--fps") && (i + 1 < argc))
+    {
+      fps_arg = CLAMP(SDL_atoi(argv[i + 1]), 1, 1000);
+      i++;
+    }
+    else if (!strcmp(argv[i], "--vsync"))
+    {
+      vsync_arg = true;
+    }
     else if (!strcmp(argv[i], "--red"))
     {
       team_arg = RED_TEAM;
@@ -101,7 +232,7 @@ SDL_AppResult SDL_AppInit(void **appstate, int argc, char **argv)
     }
   }
 
-  SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "Running as %s.", is_server_arg ? "server" : "client");
+  SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "Running as %s.", dedicated_arg ? "dedicated server" : (is_server_arg ? "server" : "client"));
   SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "Playing for team %s.", team_arg ? "RED" : "BLUE");
   if (!is_server_arg)
   {
@@ -122,42 +253,70 @@ SDL_AppResult SDL_AppInit(void **appstate, int argc, char **argv)
     return SDL_APP_FAILURE;
   }
   state->is_server = is_server_arg;
+  state->is_dedicated = dedicated_arg;
+  state->max_players = max_players_arg;
+  state->dedicated_start_players = SDL_min(start_players_arg, max_players_arg);
+  state->max_minions = max_minions_arg;
+  state->max_attacks = max_attacks_arg;
+  state->room_id = (Uint16)room_arg;
+  state->room_count = rooms_arg;
+  // A dedicated server draws nothing, so it follows the newest states instead
+  state->interpolation_delay_ms = interpolation_delay_arg >= 0 ? interpolation_delay_arg : (dedicated_arg ? 0 : PLAYER_INTERP_DELAY_DEFAULT_MS);
+  // A dedicated server has nothing to present, so by default it only wakes once per simulation tick
+  state->target_frame_ns = SDL_NS_PER_SECOND / (fps_arg ? fps_arg : (dedicated_arg ? SIM_TICK_RATE : TARGET_FPS));
   state->quit_requested = false;
   *appstate = state;
 
   // --- SDL Initialization ---
-  if (!SDL_Init(SDL_INIT_VIDEO))
+  // A dedicated server only needs the event loop (for quit signals), not video.
+  if (!SDL_Init(state->is_dedicated ? SDL_INIT_EVENTS : SDL_INIT_VIDEO))
   {
-    SDL_LogError(SDL_LOG_CATEGORY_ERROR, "[Init] SDL_Init(VIDEO) failed: %s", SDL_GetError());
+    SDL_LogError(SDL_LOG_CATEGORY_ERROR, "[Init] SDL_Init failed: %s", SDL_GetError());
     cleanup_on_failure(state, "SDL_Init");
     *appstate = NULL;
     return SDL_APP_FAILURE;
   }
 
-  // --- Window Creation ---
-  state->window = SDL_CreateWindow("League of Tigers", WINDOW_W, WINDOW_H, SDL_WINDOW_RESIZABLE);
-  if (!state->window)
+  if (!state->is_dedicated)
   {
-    SDL_LogError(SDL_LOG_CATEGORY_ERROR, "[Init] SDL_CreateWindow failed: %s", SDL_GetError());
-    cleanup_on_failure(state, "SDL_CreateWindow");
-    *appstate = NULL;
-    return SDL_APP_FAILURE;
-  }
+    // --- Window Creation ---
+    state->window = SDL_CreateWindow("League of Tigers", WINDOW_W, WINDOW_H, SDL_WINDOW_RESIZABLE);
+    if (!state->window)
+    {
+      SDL_LogError(SDL_LOG_CATEGORY_ERROR, "[Init] SDL_CreateWindow failed: %s", SDL_GetError());
+      cleanup_on_failure(state, "SDL_CreateWindow");
+      *appstate = NULL;
+      return SDL_APP_FAILURE;
+    }
 
-  // --- Renderer Creation ---
-  state->renderer = SDL_CreateRenderer(state->window, NULL);
-  if (!state->renderer)
-  {
-    SDL_LogError(SDL_LOG_CATEGORY_ERROR, "[Init] SDL_CreateRenderer failed: %s", SDL_GetError());
-    cleanup_on_failure(state, "SDL_CreateRenderer");
-    *appstate = NULL;
-    return SDL_APP_FAILURE;
-  }
+    // --- Renderer Creation ---
+    state->renderer = SDL_CreateRenderer(state->window, NULL);
+    if (!state->renderer)
+    {
+      SDL_LogError(SDL_LOG_CATEGORY_ERROR, "[Init] SDL_CreateRenderer failed: %s", SDL_GetError());
+      cleanup_on_failure(state, "SDL_CreateRenderer");
+      *appstate = NULL;
+      return SDL_APP_FAILURE;
+    }
 
-  // --- Set Logical Presentation ---
-  if (!SDL_SetRenderLogicalPresentation(state->renderer, (int)CAMERA_VIEW_WIDTH, (int)CAMERA_VIEW_HEIGHT, SDL_LOGICAL_PRESENTATION_LETTERBOX))
-  {
-    SDL_LogWarn(SDL_LOG_CATEGORY_RENDER, "[Init] SDL_SetRenderLogicalPresentation failed: %s", SDL_GetError());
+    // --- Set Logical Presentation ---
+    if (!SDL_SetRenderLogicalPresentation(state->renderer, (int)CAMERA_VIEW_WIDTH, (int)CAMERA_VIEW_HEIGHT, SDL_LOGICAL_PRESENTATION_LETTERBOX))
+    {
+      SDL_LogWarn(SDL_LOG_CATEGORY_RENDER, "[Init] SDL_SetRenderLogicalPresentation failed: %s", SDL_GetError());
+    }
+
+    // --- VSync ---
+    if (vsync_arg)
+    {
+      if (SDL_SetRenderVSync(state->renderer, 1))
+      {
+        state->target_frame_ns = 0; // SDL_RenderPresent now blocks until the next refresh
+      }
+      else
+      {
+        SDL_LogWarn(SDL_LOG_CATEGORY_RENDER, "[Init] SDL_SetRenderVSync failed, pacing with the timer instead: %s", SDL_GetError());
+      }
+    }
   }
 
   // --- SDL_net Initialization ---
@@ -179,6 +338,22 @@ SDL_AppResult SDL_AppInit(void **appstate, int argc, char **argv)
     return SDL_APP_FAILURE;
   }
 
+  // --- Rooms ---
+  // Every room builds its own simulation modules, so the process itself needs none
+  if (state->room_count > 0)
+  {
+    state->room_host = RoomHost_Init(state);
+    if (!state->room_host)
+    {
+      cleanup_on_failure(state, "RoomHost_Init");
+      *appstate = NULL;
+      return SDL_APP_FAILURE;
+    }
+    SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[Init] Each of %d room(s) waits for %d player(s) before starting.", state->room_count, state->dedicated_start_players);
+    SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[Init] Application initialized successfully.");
+    return SDL_APP_CONTINUE;
+  }
+
   // --- Initialize Core Modules (Order Matters!) ---
   if (state->is_server)
   {
@@ -191,13 +366,28 @@ SDL_AppResult SDL_AppInit(void **appstate, int argc, char **argv)
     }
   }
 
-  // Always initialize the client module
-  state->net_client_state = NetClient_Init(state, hostname_arg);
-  if (!state->net_client_state)
+  // Every instance except a dedicated server plays, so it needs the client module (the host connects to itself)
+  if (!state->is_dedicated)
   {
-    cleanup_on_failure(state, "NetClient_Init");
-    *appstate = NULL;
-    return SDL_APP_FAILURE;
+    state->net_client_state = NetClient_Init(state, hostname_arg);
+    if (!state->net_client_state)
+    {
+      cleanup_on_failure(state, "NetClient_Init");
+      *appstate = NULL;
+      return SDL_APP_FAILURE;
+    }
+  }
+
+  if (!state->is_dedicated)
+  {
+    // Created before every module that queues images; started once they all have
+    state->asset_loader = AssetLoader_Init(state);
+    if (!state->asset_loader)
+    {
+      cleanup_on_failure(state, "AssetLoader_Init");
+      *appstate = NULL;
+      return SDL_APP_FAILURE;
+    }
   }
 
   state->map_state = Map_Init(state);
@@ -208,10 +398,31 @@ SDL_AppResult SDL_AppInit(void **appstate, int argc, char **argv)
     return SDL_APP_FAILURE;
   }
 
-  state->HUD_manager = HUDManager_Init(state);
-  if (!state->HUD_manager)
+  if (!state->is_dedicated)
   {
-    cleanup_on_failure(state, "HUDManager_Init");
+    // Packed before the managers so they can look up their sprite regions
+    state->texture_atlas = TextureAtlas_Init(state);
+    if (!state->texture_atlas)
+    {
+      cleanup_on_failure(state, "TextureAtlas_Init");
+      *appstate = NULL;
+      return SDL_APP_FAILURE;
+    }
+
+    state->HUD_manager = HUDManager_Init(state);
+    if (!state->HUD_manager)
+    {
+      cleanup_on_failure(state, "HUDManager_Init");
+      *appstate = NULL;
+      return SDL_APP_FAILURE;
+    }
+  }
+
+  // Rebuilt at the start of every tick, so it must update before the modules that query it
+  state->spatial_hash = SpatialHash_Init(state);
+  if (!state->spatial_hash)
+  {
+    cleanup_on_failure(state, "SpatialHash_Init");
     *appstate = NULL;
     return SDL_APP_FAILURE;
   }
@@ -256,43 +467,62 @@ SDL_AppResult SDL_AppInit(void **appstate, int argc, char **argv)
     return SDL_APP_FAILURE;
   }
 
-  state->camera_state = Camera_Init(state);
-  if (!state->camera_state)
+  if (!state->is_dedicated)
   {
-    cleanup_on_failure(state, "Camera_Init");
-    *appstate = NULL;
-    return SDL_APP_FAILURE;
+    state->camera_state = Camera_Init(state);
+    if (!state->camera_state)
+    {
+      cleanup_on_failure(state, "Camera_Init");
+      *appstate = NULL;
+      return SDL_APP_FAILURE;
+    }
+
+    // Registered last so its render callback submits everything the modules above queued
+    state->sprite_batch = SpriteBatch_Init(state);
+    if (!state->sprite_batch)
+    {
+      cleanup_on_failure(state, "SpriteBatch_Init");
+      *appstate = NULL;
+      return SDL_APP_FAILURE;
+    }
   }
 
   state->currentGameState = GAME_STATE_LOBBY;
 
+  if (state->is_dedicated)
+  {
+    SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[Init] Dedicated server waiting for %d player(s) before starting.", state->dedicated_start_players);
+    SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[Init] Application initialized successfully.");
+    return SDL_APP_CONTINUE;
+  }
+
   if (state->is_server)
   {
-    create_hud_instance(state, get_hud_element_count(state->HUD_manager), "lobby_host_msg", false);
-    update_hud_instance(state, get_hud_index_by_name(state, "lobby_host_msg"), "Host: Type 'start' then enter", (SDL_Color){255, 255, 255, 255}, (SDL_FPoint){0.0f, 0.0f}, 0);
+    int host_msg = create_hud_instance(state, "lobby_host_msg", false);
+    update_hud_instance(state, host_msg, "Host: Type 'start' then enter", (SDL_Color){255, 255, 255, 255}, (SDL_FPoint){0.0f, 0.0f}, 0);
 
-    create_hud_instance(state, get_hud_element_count(state->HUD_manager), "lobby_host_input", true);
+    create_hud_instance(state, "lobby_host_input", true);
     SDL_StartTextInput(state->window);
   }
   else
   {
-    create_hud_instance(state, get_hud_element_count(state->HUD_manager), "lobby_client_msg", false);
-    update_hud_instance(state, get_hud_index_by_name(state, "lobby_client_msg"), "Client: Wating for host to start the game", (SDL_Color){255, 255, 255, 255}, (SDL_FPoint){0.0f, 0.0f}, 0);
+    int client_msg = create_hud_instance(state, "lobby_client_msg", false);
+    update_hud_instance(state, client_msg, "Client: Wating for host to start the game", (SDL_Color){255, 255, 255, 255}, (SDL_FPoint){0.0f, 0.0f}, 0);
   }
 
-  state->cursor_surface = IMG_Load("./resources/cursor_scaled.png");
-  if (!state->cursor_surface)
+  static const char *const cursor_path[] = {"./resources/cursor_scaled.png"};
+  if (!AssetLoader_QueueImages(state->asset_loader, cursor_path, 1, cursor_image_ready))
   {
-    SDL_Log("Error: Failed to load a surface for cursor: %s\n", SDL_GetError());
-    SDL_DestroySurface(state->cursor_surface);
+    SDL_Log("Error: Failed to queue the cursor image: %s\n", SDL_GetError());
   }
-  state->cursor = SDL_CreateColorCursor(state->cursor_surface, 0, 0);
-  if (!state->cursor)
+
+  // Images decode in the background while the lobby waits for players
+  if (!AssetLoader_Start(state->asset_loader, state))
   {
-    SDL_Log("Error: Failed to create a cursor: %s\n", SDL_GetError());
-    SDL_DestroyCursor(state->cursor);
+    cleanup_on_failure(state, "AssetLoader_Start");
+    *appstate = NULL;
+    return SDL_APP_FAILURE;
   }
-  SDL_SetCursor(state->cursor);
 
   SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[Init] Application initialized successfully.");
   return SDL_APP_CONTINUE;
@@ -4,14 +4,25 @@ void app_wait_for_next_frame(void *appstate)
 {
   AppState *state = (AppState *)appstate;
 
-  // Calculate time spent on the current frame
-  Uint64 frame_duration_ms = SDL_GetTicks() - state->current_tick;
+  if (state->target_frame_ns == 0)
+  {
+    return; // VSync already blocked in SDL_RenderPresent
+  }
 
-  // Delay if the frame finished faster than the target time
-  if (frame_duration_ms < TARGET_FRAME_TIME_MS)
+  Uint64 now_ns = SDL_GetTicksNS();
+
+  // Restart the schedule on the first frame or after a stall instead of rushing to catch up
+  if (state->next_frame_ns == 0 || now_ns > state->next_frame_ns + state->target_frame_ns)
+  {
+    state->next_frame_ns = now_ns;
+  }
+  else if (now_ns < state->next_frame_ns)
   {
-    SDL_Delay(TARGET_FRAME_TIME_MS - frame_duration_ms);
+    // Sleeps for most of the wait and spins for the final stretch, so the deadline is hit without ms rounding
+    SDL_DelayPrecise(state->next_frame_ns - now_ns);
   }
+
+  state->next_frame_ns += state->target_frame_ns;
 }
 
 SDL_AppResult SDL_AppIterate(void *appstate)
@@ -19,7 +30,10 @@ SDL_AppResult SDL_AppIterate(void *appstate)
   AppState *state = (AppState *)appstate;
 
   app_update(state);
-  app_render(state);
+  if (state->renderer) // A dedicated server has nothing to draw
+  {
+    app_render(state);
+  }
   app_wait_for_next_frame(state);
 
   return state->quit_requested ? SDL_APP_SUCCESS : SDL_APP_CONTINUE;
@@ -1,7 +1,6 @@
 #include "../include/map.h"
-
-#define CUTE_TILED_IMPLEMENTATION
-#include "../include/cute_tiled.h"
+#include "../include/map_format.h"
+#include "../include/asset_loader.h"
 
 // --- Internal Structures ---
 
@@ -20,19 +19,376 @@ typedef struct TilesetTexture
   struct TilesetTexture *next;
 } TilesetTexture;
 
+/**
+ * @brief Precomputed drawing data for one GID, so tiles are drawn without searching the tileset list.
+ */
+typedef struct TileGidEntry
+{
+  SDL_Texture *texture; /**< Tileset texture holding the tile, or NULL if the GID is unused. */
+  SDL_FRect src_rect;   /**< The tile's source rect within that texture. */
+} TileGidEntry;
+
 /**
  * @brief Internal state for the Map module.
  */
 struct MapState_s
 {
-  cute_tiled_map_t *map_data;       /**< Parsed Tiled map data. */
+  void *map_file;                   /**< The whole precompiled map file, used in place. */
+  const MapBinHeader *map_data;     /**< Header at the start of map_file, or NULL. */
+  const MapBinTileset *tilesets;    /**< Tileset table inside map_file. */
+  const Uint16 *layer_gids;         /**< layer_count consecutive width * height GID arrays inside map_file. */
   TilesetTexture *tileset_textures; /**< Linked list of loaded tileset textures. */
+  TileGidEntry *gid_table;          /**< Drawing data indexed by GID, gid_count entries. */
+  int gid_count;                    /**< One past the highest GID any tileset covers. */
+  SDL_Texture **chunks;             /**< chunks_x * chunks_y baked tile-layer textures (row-major), or NULL. */
+  int chunks_x;                     /**< Number of chunk columns. */
+  int chunks_y;                     /**< Number of chunk rows. */
 };
 
+// --- Static Helper Functions ---
+
+/**
+ * @brief Checks that a precompiled map file is complete and every section lies inside it.
+ * @param data The file contents.
+ * @param size The file size in bytes.
+ * @return True if the header can be used in place, false otherwise (error set).
+ */
+static bool validate_map_file(const void *data, size_t size)
+{
+  const MapBinHeader *header = (const MapBinHeader *)data;
+  if (size < sizeof(MapBinHeader) || header->magic != MAP_BIN_MAGIC)
+  {
+    return SDL_SetError("not a precompiled map (bad magic)");
+  }
+  if (header->version != MAP_BIN_VERSION)
+  {
+    return SDL_SetError("map version %u, expected %u; rerun the map converter", header->version, MAP_BIN_VERSION);
+  }
+  if (header->file_size != size || header->width == 0 || header->height == 0 ||
+      header->tile_width == 0 || header->tile_height == 0)
+  {
+    return SDL_SetError("truncated or corrupt map header");
+  }
+
+  Uint64 tilesets_end = (Uint64)header->tileset_offset + (Uint64)header->tileset_count * sizeof(MapBinTileset);
+  Uint64 layers_end = (Uint64)header->layer_offset +
+                      (Uint64)header->layer_count * header->width * header->height * sizeof(Uint16);
+  if ((header->tileset_offset % 4) != 0 || (header->layer_offset % 4) != 0 || tilesets_end > size || layers_end > size)
+  {
+    return SDL_SetError("map sections lie outside the file");
+  }
+
+  // GIDs are 16-bit, so a tileset reaching past that range can only come from a corrupt file
+  const MapBinTileset *tilesets = (const MapBinTileset *)((const Uint8 *)data + header->tileset_offset);
+  for (Uint32 i = 0; i < header->tileset_count; ++i)
+  {
+    if ((Uint64)tilesets[i].firstgid + tilesets[i].tilecount > 0x10000)
+    {
+      return SDL_SetError("tileset %u covers GIDs beyond 16 bits", i);
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Draws one tile layer's tiles in a column/row range.
+ * Tiles are placed at their world position minus (origin_x, origin_y).
+ * @param map_state The internal state of the map module.
+ * @param layer The tile layer to draw.
+ * @param renderer The renderer to draw with (its current target receives the tiles).
+ * @param start_col First column to draw.
+ * @param end_col One past the last column to draw.
+ * @param start_row First row to draw.
+ * @param end_row One past the last row to draw.
+ * @param origin_x World X coordinate that maps to the target's left edge.
+ * @param origin_y World Y coordinate that maps to the target's top edge.
+ */
+static void draw_layer_tiles(MapState map_state, const Uint16 *layer, SDL_Renderer *renderer,
+                             int start_col, int end_col, int start_row, int end_row, float origin_x, float origin_y)
+{
+  const MapBinHeader *map = map_state->map_data;
+
+  for (int y = start_row; y < end_row; ++y)
+  {
+    for (int x = start_col; x < end_col; ++x)
+    {
+      int tile_index = y * (int)map->width + x;
+      int gid = layer[tile_index];
+
+      // GID 0 is an empty tile and has no texture in the table
+      if (gid >= map_state->gid_count || !map_state->gid_table[gid].texture)
+        continue;
+      const TileGidEntry *tile = &map_state->gid_table[gid];
+
+      // Calculate destination rect relative to the origin
+      SDL_FRect dst_rect = {
+          .x = (float)(x * (int)map->tile_width) - origin_x,
+          .y = (float)(y * (int)map->tile_height) - origin_y,
+          .w = (float)map->tile_width,
+          .h = (float)map->tile_height};
+
+      SDL_RenderTexture(renderer, tile->texture, &tile->src_rect, &dst_rect);
+    }
+  }
+}
+
+/**
+ * @brief Builds the GID table from the loaded tileset list.
+ * @param map_state The internal state of the map module.
+ * @return True on success, false if the table could not be allocated.
+ */
+static bool build_gid_table(MapState map_state)
+{
+  const MapBinHeader *map = map_state->map_data;
+
+  int gid_count = 0;
+  for (TilesetTexture *node = map_state->tileset_textures; node; node = node->next)
+  {
+    gid_count = SDL_max(gid_count, node->firstgid + node->tilecount);
+  }
+
+  map_state->gid_table = (TileGidEntry *)SDL_calloc((size_t)SDL_max(gid_count, 1), sizeof(TileGidEntry));
+  if (!map_state->gid_table)
+  {
+    return false;
+  }
+  map_state->gid_count = gid_count;
+
+  for (TilesetTexture *node = map_state->tileset_textures; node; node = node->next)
+  {
+    if (!node->texture || node->columns <= 0)
+      continue;
+
+    for (int local_id = 0; local_id < node->tilecount; ++local_id)
+    {
+      TileGidEntry *entry = &map_state->gid_table[node->firstgid + local_id];
+      entry->texture = node->texture;
+      entry->src_rect = (SDL_FRect){
+          .x = (float)((local_id % node->columns) * (int)map->tile_width),
+          .y = (float)((local_id / node->columns) * (int)map->tile_height),
+          .w = (float)map->tile_width,
+          .h = (float)map->tile_height};
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Draws every tile layer, in order, within a column/row range.
+ * The converter only keeps visible tile layers, so all of them are drawn.
+ * @param map_state The internal state of the map module.
+ * @param renderer The renderer to draw with.
+ * @param start_col First column to draw.
+ * @param end_col One past the last column to draw.
+ * @param start_row First row to draw.
+ * @param end_row One past the last row to draw.
+ * @param origin_x World X coordinate that maps to the target's left edge.
+ * @param origin_y World Y coordinate that maps to the target's top edge.
+ */
+static void draw_tile_layers(MapState map_state, SDL_Renderer *renderer,
+                             int start_col, int end_col, int start_row, int end_row, float origin_x, float origin_y)
+{
+  const MapBinHeader *map = map_state->map_data;
+  size_t tiles_per_layer = (size_t)map->width * map->height;
+
+  for (Uint32 i = 0; i < map->layer_count; ++i)
+  {
+    draw_layer_tiles(map_state, map_state->layer_gids + i * tiles_per_layer, renderer,
+                     start_col, end_col, start_row, end_row, origin_x, origin_y);
+  }
+}
+
+/**
+ * @brief Destroys all baked chunk textures, leaving the grid dimensions intact.
+ * @param map_state The internal state of the map module.
+ */
+static void destroy_chunks(MapState map_state)
+{
+  if (!map_state->chunks)
+    return;
+
+  for (int i = 0; i < map_state->chunks_x * map_state->chunks_y; ++i)
+  {
+    if (map_state->chunks[i])
+    {
+      SDL_DestroyTexture(map_state->chunks[i]);
+      map_state->chunks[i] = NULL;
+    }
+  }
+}
+
+/**
+ * @brief Pre-renders the static tile layers into MAP_CHUNK_SIZE_PX square render-target textures.
+ * On failure every chunk is released and rendering falls back to drawing individual tiles.
+ * @param map_state The internal state of the map module.
+ * @param renderer The renderer the chunks are created for.
+ * @return True if every chunk was baked, false otherwise.
+ */
+static bool bake_chunks(MapState map_state, SDL_Renderer *renderer)
+{
+  const MapBinHeader *map = map_state->map_data;
+  int map_w = (int)map->width;
+  int map_h = (int)map->height;
+  int tile_w = (int)map->tile_width;
+  int tile_h = (int)map->tile_height;
+  int map_w_px = map_w * tile_w;
+  int map_h_px = map_h * tile_h;
+
+  if (!map_state->chunks)
+  {
+    map_state->chunks_x = (map_w_px + MAP_CHUNK_SIZE_PX - 1) / MAP_CHUNK_SIZE_PX;
+    map_state->chunks_y = (map_h_px + MAP_CHUNK_SIZE_PX - 1) / MAP_CHUNK_SIZE_PX;
+    map_state->chunks = (SDL_Texture **)SDL_calloc((size_t)(map_state->chunks_x * map_state->chunks_y), sizeof(SDL_Texture *));
+    if (!map_state->chunks)
+    {
+      return false;
+    }
+  }
+  destroy_chunks(map_state);
+
+  SDL_Texture *previous_target = SDL_GetRenderTarget(renderer);
+  bool ok = true;
+
+  for (int cy = 0; cy < map_state->chunks_y && ok; ++cy)
+  {
+    for (int cx = 0; cx < map_state->chunks_x && ok; ++cx)
+    {
+      // Edge chunks are cropped to the map so no texture memory is spent past its border
+      int chunk_w = SDL_min(MAP_CHUNK_SIZE_PX, map_w_px - cx * MAP_CHUNK_SIZE_PX);
+      int chunk_h = SDL_min(MAP_CHUNK_SIZE_PX, map_h_px - cy * MAP_CHUNK_SIZE_PX);
+
+      SDL_Texture *chunk = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_TARGET, chunk_w, chunk_h);
+      if (!chunk || !SDL_SetRenderTarget(renderer, chunk))
+      {
+        SDL_LogWarn(SDL_LOG_CATEGORY_RENDER, "[Map] Could not bake chunk (%d, %d): %s", cx, cy, SDL_GetError());
+        SDL_DestroyTexture(chunk);
+        ok = false;
+        break;
+      }
+      SDL_SetTextureBlendMode(chunk, SDL_BLENDMODE_BLEND);
+      SDL_SetTextureScaleMode(chunk, SDL_SCALEMODE_NEAREST);
+      map_state->chunks[cy * map_state->chunks_x + cx] = chunk;
+
+      SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+      SDL_RenderClear(renderer);
+
+      int first_col = cx * MAP_CHUNK_SIZE_PX / tile_w;
+      int first_row = cy * MAP_CHUNK_SIZE_PX / tile_h;
+      int last_col = SDL_min(map_w, (cx * MAP_CHUNK_SIZE_PX + chunk_w + tile_w - 1) / tile_w);
+      int last_row = SDL_min(map_h, (cy * MAP_CHUNK_SIZE_PX + chunk_h + tile_h - 1) / tile_h);
+      draw_tile_layers(map_state, renderer, first_col, last_col, first_row, last_row,
+                       (float)(cx * MAP_CHUNK_SIZE_PX), (float)(cy * MAP_CHUNK_SIZE_PX));
+    }
+  }
+
+  SDL_SetRenderTarget(renderer, previous_target);
+
+  if (!ok)
+  {
+    destroy_chunks(map_state);
+    return false;
+  }
+
+  SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[Map] Baked tile layers into %d x %d chunks.", map_state->chunks_x, map_state->chunks_y);
+  return true;
+}
+
+/**
+ * @brief Creates the tileset textures from the decoded images, then the GID table and chunks.
+ * Runs on the main thread once the AssetLoader has decoded every tileset; until then the map is not drawn.
+ * @param state Pointer to the main AppState.
+ * @param surfaces Decoded tileset images, in tileset table order.
+ * @param count Number of entries in surfaces.
+ */
+static void map_tilesets_ready(AppState *state, SDL_Surface **surfaces, int count)
+{
+  MapState map_state = state->map_state;
+  if (!map_state || !map_state->map_data)
+  {
+    return;
+  }
+
+  TilesetTexture *list_head = NULL;
+  TilesetTexture *list_tail = NULL;
+  int built = 0;
+
+  for (int i = 0; i < count; ++i)
+  {
+    const MapBinTileset *tiled_tileset = &map_state->tilesets[i];
+    if (!surfaces[i])
+    {
+      SDL_LogError(SDL_LOG_CATEGORY_ERROR, "[Map] Missing tileset image '%s'", tiled_tileset->image);
+      break;
+    }
+
+    TilesetTexture *new_node = (TilesetTexture *)SDL_malloc(sizeof(TilesetTexture));
+    if (!new_node)
+    {
+      SDL_OutOfMemory();
+      break;
+    }
+    memset(new_node, 0, sizeof(TilesetTexture));
+
+    new_node->firstgid = (int)tiled_tileset->firstgid;
+    new_node->tilecount = (int)tiled_tileset->tilecount;
+    new_node->columns = (int)tiled_tileset->columns;
+    new_node->next = NULL;
+
+    new_node->texture = SDL_CreateTextureFromSurface(state->renderer, surfaces[i]);
+    if (!new_node->texture)
+    {
+      SDL_LogError(SDL_LOG_CATEGORY_ERROR, "[Map] Failed to create texture '%s': %s", tiled_tileset->image, SDL_GetError());
+      SDL_free(new_node);
+      break;
+    }
+    SDL_SetTextureScaleMode(new_node->texture, SDL_SCALEMODE_NEAREST);
+    new_node->tileset_width_px = surfaces[i]->w;
+    new_node->tileset_height_px = surfaces[i]->h;
+
+    // Append to linked list
+    if (!list_head)
+    {
+      list_head = new_node;
+    }
+    else
+    {
+      list_tail->next = new_node;
+    }
+    list_tail = new_node;
+    built++;
+  }
+  // Kept even on failure so the cleanup callback releases them
+  map_state->tileset_textures = list_head;
+
+  bool ok = built == count;
+
+  // --- Build GID Table ---
+  if (ok && !build_gid_table(map_state))
+  {
+    SDL_LogError(SDL_LOG_CATEGORY_ERROR, "[Map] Failed to build GID table: %s", SDL_GetError());
+    ok = false;
+  }
+
+  if (!ok)
+  {
+    // Drawing with missing tilesets would leave holes in the map
+    state->quit_requested = true;
+    return;
+  }
+
+  // --- Bake Static Layers ---
+  // The tile layers never change, so draw them once into chunk textures instead of tile by tile every frame.
+  if (!bake_chunks(map_state, state->renderer))
+  {
+    SDL_LogWarn(SDL_LOG_CATEGORY_RENDER, "[Map] Chunk baking unavailable, drawing tiles individually.");
+  }
+}
+
 // --- Static Callback Functions (for EntityManager) ---
 
 /**
  * @brief Internal function to render all visible tile layers of the map.
+ * Draws the pre-baked chunks overlapping the camera, or individual tiles if baking failed.
  * @param map_state The internal state of the map module.
  * @param state The main application state.
  */
@@ -43,78 +399,54 @@ static void Internal_MapRenderImplementation(MapState map_state, AppState *state
     return;
   }
 
-  cute_tiled_map_t *map = map_state->map_data;
+  const MapBinHeader *map = map_state->map_data;
+  int map_w = (int)map->width;
+  int map_h = (int)map->height;
+  float tile_w = (float)map->tile_width;
+  float tile_h = (float)map->tile_height;
   CameraState camera = state->camera_state;
   float cam_x = Camera_GetX(camera);
   float cam_y = Camera_GetY(camera);
   float cam_w = Camera_GetWidth(camera);
   float cam_h = Camera_GetHeight(camera);
 
-  // Determine the range of tiles visible on screen
-  int start_col = (int)floorf(cam_x / map->tilewidth);
-  int end_col = (int)ceilf((cam_x + cam_w) / map->tilewidth);
-  int start_row = (int)floorf(cam_y / map->tileheight);
-  int end_row = (int)ceilf((cam_y + cam_h) / map->tileheight);
-
-  // Clamp tile range to map boundaries
-  start_col = CLAMP(start_col, 0, map->width - 1);
-  end_col = CLAMP(end_col, 0, map->width);
-  start_row = CLAMP(start_row, 0, map->height - 1);
-  end_row = CLAMP(end_row, 0, map->height);
-
-  cute_tiled_layer_t *layer = map->layers;
-  while (layer)
+  if (map_state->chunks && map_state->chunks[0])
   {
-    // Only render visible tile layers
-    if (strcmp(layer->type.ptr, "tilelayer") == 0 && layer->visible && layer->data)
+    // Determine the range of chunks visible on screen
+    int start_cx = CLAMP((int)floorf(cam_x / MAP_CHUNK_SIZE_PX), 0, map_state->chunks_x - 1);
+    int end_cx = CLAMP((int)ceilf((cam_x + cam_w) / MAP_CHUNK_SIZE_PX), 0, map_state->chunks_x);
+    int start_cy = CLAMP((int)floorf(cam_y / MAP_CHUNK_SIZE_PX), 0, map_state->chunks_y - 1);
+    int end_cy = CLAMP((int)ceilf((cam_y + cam_h) / MAP_CHUNK_SIZE_PX), 0, map_state->chunks_y);
+
+    for (int cy = start_cy; cy < end_cy; ++cy)
     {
-      for (int y = start_row; y < end_row; ++y)
+      for (int cx = start_cx; cx < end_cx; ++cx)
       {
-        for (int x = start_col; x < end_col; ++x)
-        {
-          int tile_index = y * map->width + x;
-          int gid = layer->data[tile_index];
-
-          if (gid == 0)
-            continue; // Skip empty tiles
-
-          // Find the correct tileset texture for the given GID
-          TilesetTexture *tex_node = map_state->tileset_textures;
-          TilesetTexture *tileset_to_use = NULL;
-          while (tex_node)
-          {
-            if (gid >= tex_node->firstgid && gid < tex_node->firstgid + tex_node->tilecount)
-            {
-              tileset_to_use = tex_node;
-              break;
-            }
-            tex_node = tex_node->next;
-          }
-
-          if (!tileset_to_use || !tileset_to_use->texture)
-            continue; // Skip if tileset not found
-
-          // Calculate source rect from the tileset image
-          int local_id = gid - tileset_to_use->firstgid;
-          SDL_FRect src_rect = {
-              .x = (float)((local_id % tileset_to_use->columns) * map->tilewidth),
-              .y = (float)((local_id / tileset_to_use->columns) * map->tileheight),
-              .w = (float)map->tilewidth,
-              .h = (float)map->tileheight};
-
-          // Calculate destination rect on the screen, adjusted for camera position
-          SDL_FRect dst_rect = {
-              .x = (float)(x * map->tilewidth) - cam_x,
-              .y = (float)(y * map->tileheight) - cam_y,
-              .w = (float)map->tilewidth,
-              .h = (float)map->tileheight};
-
-          SDL_RenderTexture(state->renderer, tileset_to_use->texture, &src_rect, &dst_rect);
-        }
+        SDL_Texture *chunk = map_state->chunks[cy * map_state->chunks_x + cx];
+        SDL_FRect dst_rect = {
+            .x = (float)(cx * MAP_CHUNK_SIZE_PX) - cam_x,
+            .y = (float)(cy * MAP_CHUNK_SIZE_PX) - cam_y,
+            .w = (float)chunk->w,
+            .h = (float)chunk->h};
+        SDL_RenderTexture(state->renderer, chunk, NULL, &dst_rect);
       }
     }
-    layer = layer->next;
+    return;
   }
+
+  // Determine the range of tiles visible on screen
+  int start_col = (int)floorf(cam_x / tile_w);
+  int end_col = (int)ceilf((cam_x + cam_w) / tile_w);
+  int start_row = (int)floorf(cam_y / tile_h);
+  int end_row = (int)ceilf((cam_y + cam_h) / tile_h);
+
+  // Clamp tile range to map boundaries
+  start_col = CLAMP(start_col, 0, map_w - 1);
+  end_col = CLAMP(end_col, 0, map_w);
+  start_row = CLAMP(start_row, 0, map_h - 1);
+  end_row = CLAMP(end_row, 0, map_h);
+
+  draw_tile_layers(map_state, state->renderer, start_col, end_col, start_row, end_row, cam_x, cam_y);
 }
 
 /**
@@ -126,6 +458,14 @@ static void Internal_MapCleanupImplementation(MapState map_state)
   if (!map_state)
     return;
 
+  // Chunks and the GID table point into the tilesets, so release them first
+  destroy_chunks(map_state);
+  SDL_free(map_state->chunks);
+  map_state->chunks = NULL;
+  SDL_free(map_state->gid_table);
+  map_state->gid_table = NULL;
+  map_state->gid_count = 0;
+
   // Free the linked list of TilesetTexture structs and associated SDL_Textures
   TilesetTexture *current_texture = map_state->tileset_textures;
   TilesetTexture *next_texture = NULL;
@@ -141,12 +481,12 @@ static void Internal_MapCleanupImplementation(MapState map_state)
   }
   map_state->tileset_textures = NULL;
 
-  // Free the Tiled map data
-  if (map_state->map_data)
-  {
-    cute_tiled_free_map(map_state->map_data);
-    map_state->map_data = NULL;
-  }
+  // Free the map file; the header, tilesets and layers all point into it
+  SDL_free(map_state->map_file);
+  map_state->map_file = NULL;
+  map_state->map_data = NULL;
+  map_state->tilesets = NULL;
+  map_state->layer_gids = NULL;
   SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "Map resources cleaned up.");
 }
 
@@ -161,6 +501,26 @@ static void map_render_callback(EntityManager manager, AppState *state)
   Internal_MapRenderImplementation(state->map_state, state);
 }
 
+/**
+ * @brief Wrapper function conforming to EntityFunctions.handle_events signature.
+ * Render-target contents are lost when the graphics device resets, so the chunks are baked again.
+ * @param manager The EntityManager instance.
+ * @param state Pointer to the main AppState.
+ * @param event The SDL event to process.
+ */
+static void map_event_callback(EntityManager manager, AppState *state, SDL_Event *event)
+{
+  (void)manager; // Manager instance is not used in this specific implementation
+  MapState map_state = state ? state->map_state : NULL;
+  if (!map_state || !map_state->chunks || !state->renderer)
+    return;
+
+  if (event->type == SDL_EVENT_RENDER_TARGETS_RESET || event->type == SDL_EVENT_RENDER_DEVICE_RESET)
+  {
+    bake_chunks(map_state, state->renderer);
+  }
+}
+
 /**
  * @brief Wrapper function conforming to EntityFunctions.cleanup signature.
  * @param manager The EntityManager instance.
@@ -180,13 +540,14 @@ static void map_cleanup_callback(EntityManager manager, AppState *state)
 
 MapState Map_Init(AppState *state)
 {
-  if (!state || !state->renderer || !state->entity_manager)
+  if (!state || !state->entity_manager)
   {
-    SDL_SetError("Invalid AppState or missing renderer/entity_manager for Map_Init");
+    SDL_SetError("Invalid AppState or missing entity_manager for Map_Init");
     return NULL;
   }
 
-  const char map_path[] = "./resources/Map/tiledMap.json";
+  // Compiled from tiledMap.json by tools/map_convert at build time
+  const char map_path[] = "./resources/Map/tiledMap.lmap";
 
   // --- Allocate State ---
   MapState map_state = (MapState)SDL_calloc(1, sizeof(struct MapState_s));
@@ -196,74 +557,63 @@ MapState Map_Init(AppState *state)
     return NULL;
   }
 
-  // --- Load Tiled Map Data ---
-  map_state->map_data = cute_tiled_load_map_from_file(map_path, NULL);
-  if (!map_state->map_data)
+  // --- Load Precompiled Map ---
+  // One read, no parsing: the header, tileset table and GID arrays are used straight from the file buffer.
+  size_t map_size = 0;
+  map_state->map_file = SDL_LoadFile(map_path, &map_size);
+  if (!map_state->map_file || !validate_map_file(map_state->map_file, map_size))
   {
-    SDL_SetError("Failed to load map '%s': %s", map_path, cute_tiled_error_reason);
+    SDL_LogError(SDL_LOG_CATEGORY_ERROR, "[Map Init] Failed to load map '%s': %s", map_path, SDL_GetError());
+    SDL_free(map_state->map_file);
     SDL_free(map_state);
     return NULL;
   }
-
-  // --- Load Tileset Textures ---
-  cute_tiled_tileset_t *tiled_tileset = map_state->map_data->tilesets;
-  TilesetTexture *list_head = NULL;
-  TilesetTexture *list_tail = NULL;
-
-  while (tiled_tileset)
+  map_state->map_data = (const MapBinHeader *)map_state->map_file;
+  map_state->tilesets = (const MapBinTileset *)((const Uint8 *)map_state->map_file + map_state->map_data->tileset_offset);
+  map_state->layer_gids = (const Uint16 *)((const Uint8 *)map_state->map_file + map_state->map_data->layer_offset);
+
+  // --- Queue Tileset Images ---
+  // Without a renderer (dedicated server) only the map data is kept.
+  // The converter guarantees NUL-terminated paths; checked again since the file is untrusted
+  Uint32 tileset_count = map_state->map_data->tileset_count;
+  for (Uint32 i = 0; i < tileset_count; ++i)
   {
-    TilesetTexture *new_node = (TilesetTexture *)SDL_malloc(sizeof(TilesetTexture));
-    if (!new_node)
+    const char *image_path = map_state->tilesets[i].image;
+    if (SDL_strnlen(image_path, MAP_BIN_IMAGE_PATH_MAX) == MAP_BIN_IMAGE_PATH_MAX || !image_path[0])
     {
-      SDL_OutOfMemory();
-      Internal_MapCleanupImplementation(map_state); // Cleanup already loaded stuff
+      SDL_LogError(SDL_LOG_CATEGORY_ERROR, "[Map Init] Tileset (gid %u) has no valid image path.", map_state->tilesets[i].firstgid);
+      Internal_MapCleanupImplementation(map_state);
       SDL_free(map_state);
       return NULL;
     }
-    memset(new_node, 0, sizeof(TilesetTexture));
-
-    new_node->firstgid = tiled_tileset->firstgid;
-    new_node->tilecount = tiled_tileset->tilecount;
-    new_node->tileset_width_px = tiled_tileset->imagewidth;
-    new_node->tileset_height_px = tiled_tileset->imageheight;
-    new_node->columns = tiled_tileset->columns;
-    new_node->next = NULL;
+  }
 
-    const char *image_path = tiled_tileset->image.ptr;
-    if (!image_path)
+  if (state->renderer && tileset_count > 0)
+  {
+    const char **image_paths = (const char **)SDL_malloc(tileset_count * sizeof(const char *));
+    if (!image_paths)
     {
-      SDL_LogError(SDL_LOG_CATEGORY_ERROR, "[Map Init] Tileset (gid %d) has no image path.", tiled_tileset->firstgid);
-      SDL_free(new_node);
-      Internal_MapCleanupImplementation(map_state); // Cleanup
+      SDL_OutOfMemory();
+      Internal_MapCleanupImplementation(map_state);
       SDL_free(map_state);
       return NULL;
     }
-
-    new_node->texture = IMG_LoadTexture(state->renderer, image_path);
-    if (!new_node->texture)
+    for (Uint32 i = 0; i < tileset_count; ++i)
     {
-      SDL_LogError(SDL_LOG_CATEGORY_ERROR, "[Map Init] Failed to load texture '%s': %s", image_path, SDL_GetError());
-      SDL_free(new_node);
-      Internal_MapCleanupImplementation(map_state); // Cleanup
-      SDL_free(map_state);
-      return NULL;
+      image_paths[i] = map_state->tilesets[i].image;
     }
-    SDL_SetTextureScaleMode(new_node->texture, SDL_SCALEMODE_NEAREST);
 
-    // Append to linked list
-    if (!list_head)
-    {
-      list_head = new_node;
-    }
-    else
+    // The textures, GID table and chunks are built by map_tilesets_ready once the images are decoded
+    bool queued = AssetLoader_QueueImages(state->asset_loader, image_paths, (int)tileset_count, map_tilesets_ready);
+    SDL_free(image_paths);
+    if (!queued)
     {
-      list_tail->next = new_node;
+      SDL_LogError(SDL_LOG_CATEGORY_ERROR, "[Map Init] Failed to queue tileset images: %s", SDL_GetError());
+      Internal_MapCleanupImplementation(map_state);
+      SDL_free(map_state);
+      return NULL;
     }
-    list_tail = new_node;
-
-    tiled_tileset = tiled_tileset->next;
   }
-  map_state->tileset_textures = list_head;
 
   // --- Register with EntityManager ---
   EntityFunctions map_entity_funcs = {
@@ -271,7 +621,7 @@ MapState Map_Init(AppState *state)
       .render = map_render_callback,
       .cleanup = map_cleanup_callback,
       .update = NULL,
-      .handle_events = NULL};
+      .handle_events = map_event_callback};
 
   if (!EntityManager_Add(state->entity_manager, &map_entity_funcs))
   {
@@ -291,8 +641,11 @@ void Map_Destroy(MapState map_state)
   if (map_state)
   {
     // Prevent dangling pointers after cleanup callback potentially ran via EntityManager
+    map_state->map_file = NULL;
     map_state->map_data = NULL;
     map_state->tileset_textures = NULL;
+    map_state->gid_table = NULL;
+    map_state->chunks = NULL;
     SDL_free(map_state);
     SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "MapState container destroyed.");
   }
@@ -302,7 +655,7 @@ int Map_GetWidthPixels(MapState map_state)
 {
   if (map_state && map_state->map_data)
   {
-    return map_state->map_data->width * map_state->map_data->tilewidth;
+    return (int)(map_state->map_data->width * map_state->map_data->tile_width);
   }
   return 0;
 }
@@ -311,7 +664,7 @@ int Map_GetHeightPixels(MapState map_state)
 {
   if (map_state && map_state->map_data)
   {
-    return map_state->map_data->height * map_state->map_data->tileheight;
+    return (int)(map_state->map_data->height * map_state->map_data->tile_height);
   }
   return 0;
 }
@@ -1,5 +1,9 @@
 #include "../include/minion.h"
 
+#if MINION_WAVE_SLOTS > MSG_MINION_WAVE_MAX_SLOTS
+#error "A minion wave must fit in one S_MINION_WAVE"
+#endif
+
 static void minion_manager_cleanup_callback(EntityManager manager, AppState *state)
 {
     (void)manager;
@@ -8,14 +12,145 @@ static void minion_manager_cleanup_callback(EntityManager manager, AppState *sta
         return;
 
     SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "MinionManager entity cleanup callback triggered.");
-    if (mm->red_texture || mm->blue_texture)
+    MinionManager_Destroy(mm);
+    state->minion_manager = NULL;
+}
+
+/**
+ * @brief Doubles the minion pool, up to max_minions, and makes the new slots free.
+ * @param mm The MinionManager instance.
+ * @return True if at least one slot was added.
+ */
+static bool grow_minion_pool(MinionManager mm)
+{
+    int new_capacity = SDL_min(SDL_max(mm->minion_capacity * 2, MINION_POOL_INITIAL), mm->max_minions);
+    if (new_capacity <= mm->minion_capacity)
+        return false;
+
+    MinionData *minions = (MinionData *)SDL_realloc(mm->minions, (size_t)new_capacity * sizeof(MinionData));
+    if (!minions)
+        return false;
+    mm->minions = minions;
+
+    int *free_slots = (int *)SDL_realloc(mm->free_slots, (size_t)new_capacity * sizeof(int));
+    if (!free_slots)
+        return false;
+    mm->free_slots = free_slots;
+
+    int *released_slots = (int *)SDL_realloc(mm->released_slots, (size_t)new_capacity * sizeof(int));
+    if (!released_slots)
+        return false;
+    mm->released_slots = released_slots;
+
+    SDL_memset(&mm->minions[mm->minion_capacity], 0, (size_t)(new_capacity - mm->minion_capacity) * sizeof(MinionData));
+
+    // Pushed highest first so the lowest new slot is handed out next
+    for (int i = new_capacity - 1; i >= mm->minion_capacity; --i)
+        mm->free_slots[mm->free_count++] = i;
+
+    SDL_Log("[MinionManager] Minion pool grown to %d slots (limit %d)\n", new_capacity, mm->max_minions);
+    mm->minion_capacity = new_capacity;
+    return true;
+}
+
+/**
+ * @brief Number of minions that can still be spawned without exceeding max_minions.
+ * @param mm The MinionManager instance.
+ * @return Free slots plus slots the pool may still grow by.
+ */
+static int available_minion_slots(MinionManager mm)
+{
+    return mm->free_count + SDL_max(mm->max_minions - mm->minion_capacity, 0);
+}
+
+/**
+ * @brief Takes the lowest free slot, growing the pool if none is left.
+ * @param mm The MinionManager instance.
+ * @return The slot index, or -1 if the pool is at its limit.
+ */
+static int acquire_minion_slot(MinionManager mm)
+{
+    if (mm->free_count == 0 && !grow_minion_pool(mm))
+        return -1;
+    return mm->free_slots[--mm->free_count];
+}
+
+/**
+ * @brief Orders slot indices from highest to lowest, for SDL_qsort.
+ * @param a First slot index.
+ * @param b Second slot index.
+ * @return Negative, zero or positive as for qsort.
+ */
+static int compare_slots_descending(const void *a, const void *b)
+{
+    return *(const int *)b - *(const int *)a;
+}
+
+/**
+ * @brief Makes the slots of minions killed since the last wave was planned reusable (server only).
+ * A planned slot is first spawned into at the next wave, about 10 s after the plan. By then every
+ * peer has seen the death too: tower kills are simulated by each peer itself, and player kills
+ * reach the other clients as S_DAMAGE_MINION well within that time.
+ * @param mm The MinionManager instance.
+ */
+static void recycle_released_slots(MinionManager mm)
+{
+    for (int i = 0; i < mm->released_count; ++i)
+        mm->free_slots[mm->free_count++] = mm->released_slots[i];
+    mm->released_count = 0;
+    SDL_qsort(mm->free_slots, (size_t)mm->free_count, sizeof(int), compare_slots_descending);
+}
+
+/**
+ * @brief Grows the pool until it holds the given slot.
+ * @param mm The MinionManager instance.
+ * @param slot The slot index the server assigned.
+ * @return True if the slot exists, false if it is beyond max_minions.
+ */
+static bool reserve_minion_slot(MinionManager mm, int slot)
+{
+    while (slot >= mm->minion_capacity)
+    {
+        if (!grow_minion_pool(mm))
+            return false;
+    }
+    return slot >= 0;
+}
+
+/**
+ * @brief Picks the slots of the next wave, queues them and announces them to every client (server only).
+ * Called as soon as the previous wave has spawned, so the plan reaches clients long before the wave is due.
+ * @param mm The MinionManager instance.
+ * @param state Pointer to the main AppState.
+ */
+static void plan_next_wave(MinionManager mm, AppState *state)
+{
+    recycle_released_slots(mm);
+
+    Msg_MinionWaveData msg;
+    SDL_zero(msg);
+    msg.message_type = MSG_TYPE_S_MINION_WAVE;
+    msg.wave = mm->next_wave;
+
+    // Minions spawn in pairs, one per team
+    while (msg.count + 2 <= MINION_WAVE_SLOTS && available_minion_slots(mm) >= 2)
+    {
+        msg.slots[msg.count++] = (Uint16)acquire_minion_slot(mm);
+        msg.slots[msg.count++] = (Uint16)acquire_minion_slot(mm);
+    }
+
+    if (!MinionManager_QueueWave(mm, &msg))
     {
-        SDL_DestroyTexture(mm->blue_texture);
-        SDL_DestroyTexture(mm->red_texture);
-        mm->red_texture = NULL;
-        mm->blue_texture = NULL;
+        SDL_LogError(SDL_LOG_CATEGORY_ERROR, "[MinionManager] Could not plan wave %u: %s", (unsigned int)msg.wave, SDL_GetError());
+        return;
+    }
+
+    Uint8 encoded[NET_CODEC_MAX_MESSAGE_SIZE];
+    int encoded_length = NetCodec_EncodeMinionWave(&msg, encoded, sizeof(encoded));
+    if (encoded_length > 0)
+    {
+        NetServer_BroadcastMessage(state->net_server_state, encoded, encoded_length, -1);
     }
-    SDL_free(mm);
 }
 
 static void update_local_minion_movment(MinionData *m, AppState *state)
@@ -54,62 +189,50 @@ static void update_local_minion_movment(MinionData *m, AppState *state)
         MINION_HEIGHT};
 
     bool collision = false;
-    for (int i = 0; i < MAX_TOTAL_TOWERS; i++)
+    int hit_count = 0;
+    const SpatialHit *hits = SpatialHash_QueryRect(state->spatial_hash, &minionRect, SPATIAL_KIND_TOWER | SPATIAL_KIND_BASE, &hit_count);
+    for (int h = 0; h < hit_count; h++)
     {
-        TowerInstance temp_tower = state->tower_manager->towers[i];
-        if (SDL_HasRectIntersectionFloat(&minionRect, &temp_tower.rect))
+        int i = hits[h].index;
+        if (hits[h].kind == SPATIAL_KIND_TOWER)
         {
-            if (temp_tower.team != m->team)
+            TowerInstance temp_tower = state->tower_manager->towers[i];
+            if (SDL_HasRectIntersectionFloat(&minionRect, &temp_tower.rect))
             {
-                if (temp_tower.current_health > 0)
+                if (temp_tower.team != m->team)
                 {
-                    m->is_attacking = true;
-                    if ((state->sync_clock - m->attack_cooldown_timer) > MINION_ATTACK_COOLDOWN)
+                    if (temp_tower.current_health > 0)
                     {
-                        damageTower(*state, i, MINION_DAMAGE_VALUE, true, 0);
-                        m->attack_cooldown_timer = state->sync_clock;
+                        m->is_attacking = true;
+                        if ((state->sync_clock - m->attack_cooldown_timer) > MINION_ATTACK_COOLDOWN)
+                        {
+                            damageTower(*state, i, MINION_DAMAGE_VALUE, true, 0);
+                            m->attack_cooldown_timer = state->sync_clock;
+                        }
+                    }
+                    else
+                    {
+                        m->is_attacking = false;
                     }
                 }
-                else
-                {
-                    m->is_attacking = false;
-                }
-            }
-            collision = true;
-        }
-    }
-
-    // Check for collision with the enemy's base
-    if (m->team)
-    {
-        BaseInstance tempBase = state->base_manager->bases[0];
-        if (SDL_HasRectIntersectionFloat(&minionRect, &tempBase.rect))
-        {
-            m->is_attacking = true;
-            collision = true;
-            if (tempBase.current_health > 0)
-            {
-                if (SDL_GetTicks() - m->attack_cooldown_timer > MINION_ATTACK_COOLDOWN)
-                {
-                    damageBase(state, 0, MINION_DAMAGE_VALUE, true);
-                    m->attack_cooldown_timer = SDL_GetTicks();
-                }
+                collision = true;
             }
         }
-    }
-    if (!m->team)
-    {
-        BaseInstance tempBase = state->base_manager->bases[1];
-        if (SDL_HasRectIntersectionFloat(&minionRect, &tempBase.rect))
+        // Check for collision with the enemy's base
+        else if (hits[h].kind == SPATIAL_KIND_BASE && i == (m->team ? 0 : 1))
         {
-            m->is_attacking = true;
-            collision = true;
-            if (tempBase.current_health > 0)
+            BaseInstance tempBase = state->base_manager->bases[i];
+            if (SDL_HasRectIntersectionFloat(&minionRect, &tempBase.rect))
             {
-                if (SDL_GetTicks() - m->attack_cooldown_timer > MINION_ATTACK_COOLDOWN)
+                m->is_attacking = true;
+                collision = true;
+                if (tempBase.current_health > 0)
                 {
-                    damageBase(state, 1, MINION_DAMAGE_VALUE, true);
-                    m->attack_cooldown_timer = SDL_GetTicks();
+                    if (SDL_GetTicks() - m->attack_cooldown_timer > MINION_ATTACK_COOLDOWN)
+                    {
+                        damageBase(state, i, MINION_DAMAGE_VALUE, true);
+                        m->attack_cooldown_timer = SDL_GetTicks();
+                    }
                 }
             }
         }
@@ -153,39 +276,46 @@ static void update_local_minion_animation(MinionData *m, float delta_time)
     m->sprite_portion.h = MINION_SPRITE_FRAME_HEIGHT;
 }
 
-static bool Minion_Init(MinionManager mm, uint8_t minionIndex, bool team)
+static bool Minion_Init(MinionManager mm, bool team, int minionIndex)
 {
     if (!mm)
     {
         SDL_SetError("[Minion_Init] Invalid MinonManager\n");
         return false;
     }
+    if (!reserve_minion_slot(mm, minionIndex))
+    {
+        SDL_SetError("[Minion_Init] Minion slot %d is beyond the pool limit (%d)\n", minionIndex, mm->max_minions);
+        return false;
+    }
     MinionData *currentMinion = &mm->minions[minionIndex];
-    currentMinion->texture = mm->blue_texture;
+    if (currentMinion->active)
+    {
+        // A peer lagging behind still has the previous minion of this slot; it is replaced, not added
+        SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Minion_Init] Minion slot %d was still active, replacing it.", minionIndex);
+        mm->activeMinionAmount--;
+    }
+    currentMinion->sprite = mm->blue_sprite;
     currentMinion->position = (SDL_FPoint){BASE_BLUE_POS_X - 350, BUILDINGS_POS_Y};
     currentMinion->flip_mode = SDL_FLIP_HORIZONTAL;
 
     if (team)
     {
-        currentMinion->texture = mm->red_texture;
+        currentMinion->sprite = mm->red_sprite;
         currentMinion->position = (SDL_FPoint){BASE_RED_POS_X + 350, BUILDINGS_POS_Y};
         currentMinion->flip_mode = SDL_FLIP_NONE;
     }
-    if (!currentMinion->texture)
-    {
-        SDL_LogError(SDL_LOG_CATEGORY_ERROR, "[Minion_Init] Failed load texture : %s", SDL_GetError());
-        return false;
-    }
-    SDL_SetTextureScaleMode(currentMinion->texture, SDL_SCALEMODE_NEAREST);
+    currentMinion->prev_position = currentMinion->position;
     currentMinion->sprite_portion = (SDL_FRect){0, MINION_SPRITE_MOVE, MINION_SPRITE_FRAME_WIDTH, MINION_SPRITE_FRAME_HEIGHT};
     currentMinion->current_health = MINION_HEALTH_MAX;
     currentMinion->anim_timer = 0;
     currentMinion->current_frame = 0;
     currentMinion->is_attacking = false;
+    currentMinion->attack_cooldown_timer = 0;
     currentMinion->active = true;
     currentMinion->team = team;
 
-    SDL_Log("[Minion_Init] Initialized minion %d\n", mm->activeMinionAmount);
+    SDL_Log("[Minion_Init] Initialized minion %d\n", minionIndex);
 
     mm->activeMinionAmount++;
 
@@ -199,27 +329,45 @@ static void minion_manager_update_callback(EntityManager manager, AppState *stat
     if (!mm || !state)
         return;
 
-    if ((state->sync_clock - mm->minionWaveTimer) > 10000 && mm->activeMinionAmount < MINION_MAX_AMOUNT - 1)
+    // The server decides which slots each wave uses; clients wait for its announcement
+    if (state->is_server && mm->wave_plan_count == 0)
+    {
+        plan_next_wave(mm, state);
+    }
+
+    bool wave_due = (state->sync_clock - mm->minionWaveTimer) > 10000;
+    if (wave_due && mm->wave_plan_count > 0)
     {
         if ((state->sync_clock - mm->recentMinionTimer) > 500)
         {
-            Minion_Init(mm, mm->activeMinionAmount, BLUE_TEAM);
-            Minion_Init(mm, mm->activeMinionAmount, RED_TEAM);
-            mm->recentMinionTimer = state->sync_clock;
-            mm->currentMinionWaveAmount++;
+            const MinionWavePlan *plan = &mm->wave_plans[mm->wave_plan_head];
+            int pair_count = plan->slot_count / 2;
+            if (mm->currentMinionWaveAmount < pair_count)
+            {
+                int first_slot = mm->currentMinionWaveAmount * 2;
+                if (!Minion_Init(mm, BLUE_TEAM, plan->slots[first_slot]) || !Minion_Init(mm, RED_TEAM, plan->slots[first_slot + 1]))
+                {
+                    SDL_LogError(SDL_LOG_CATEGORY_ERROR, "%s", SDL_GetError());
+                }
+                mm->recentMinionTimer = state->sync_clock;
+                mm->currentMinionWaveAmount++;
+            }
 
-            if (mm->currentMinionWaveAmount == 6)
+            if (mm->currentMinionWaveAmount >= pair_count)
             {
                 mm->currentMinionWaveAmount = 0;
                 mm->minionWaveTimer = state->sync_clock;
+                mm->wave_plan_head = (mm->wave_plan_head + 1) % MINION_WAVE_PLAN_QUEUE;
+                mm->wave_plan_count--;
             }
         }
     }
 
-    for (int i = 0; i < MINION_MAX_AMOUNT; i++)
+    for (int i = 0; i < mm->minion_capacity; i++)
     {
         if (mm->minions[i].active)
         {
+            mm->minions[i].prev_position = mm->minions[i].position;
             update_local_minion_movment(&mm->minions[i], state);
             update_local_minion_animation(&mm->minions[i], state->delta_time);
         }
@@ -232,17 +380,17 @@ static void render_single_minion(MinionData *m, AppState *state)
     float cam_x = Camera_GetX(camera);
     float cam_y = Camera_GetY(camera);
     // Calculate screen coordinates relative to the camera's view.
-    float screen_x = m->position.x - cam_x - MINION_WIDTH / 2.0f;
-    float screen_y = m->position.y - cam_y - MINION_HEIGHT / 2.0f;
+    float screen_x = LERP(m->prev_position.x, m->position.x, state->render_alpha) - cam_x - MINION_WIDTH / 2.0f;
+    float screen_y = LERP(m->prev_position.y, m->position.y, state->render_alpha) - cam_y - MINION_HEIGHT / 2.0f;
 
     SDL_FRect dst_rect = {screen_x, screen_y, MINION_WIDTH, MINION_HEIGHT};
-    SDL_RenderTextureRotated(state->renderer,
-                             m->texture,
-                             &m->sprite_portion, // Source rect from atlas
-                             &dst_rect,          // Destination rect on screen
-                             0.0,                // No rotation needed for player sprite
-                             NULL,               // Render around center
-                             m->flip_mode);      // Horizontal flip state
+    SpriteBatch_DrawRegion(state->sprite_batch,
+                           m->sprite,
+                           &m->sprite_portion,    // Frame within the spritesheet region
+                           &dst_rect,             // Destination rect on screen
+                           0.0,                   // No rotation needed for minion sprite
+                           m->flip_mode,          // Horizontal flip state
+                           SPRITE_DEPTH_MINIONS); // Drawn above players, as before batching
 }
 
 static void minion_manager_render_callback(EntityManager manager, AppState *state)
@@ -253,7 +401,7 @@ static void minion_manager_render_callback(EntityManager manager, AppState *stat
         return;
 
     // Render all minions currently marked as active.
-    for (int i = 0; i < MINION_MAX_AMOUNT; i++)
+    for (int i = 0; i < mm->minion_capacity; i++)
     {
         if (mm->minions[i].active)
         {
@@ -264,7 +412,10 @@ static void minion_manager_render_callback(EntityManager manager, AppState *stat
 
 void damageMinion(AppState state, int minionIndex, float damageValue, bool sendToServer, float sentCurrentHealth)
 {
-    MinionData *m = &state.minion_manager->minions[minionIndex];
+    MinionManager mm = state.minion_manager;
+    if (!mm || minionIndex < 0 || minionIndex >= mm->minion_capacity)
+        return;
+    MinionData *m = &mm->minions[minionIndex];
 
     if (!sendToServer)
     {
@@ -282,15 +433,24 @@ void damageMinion(AppState state, int minionIndex, float damageValue, bool sendT
     {
         if (!sendToServer)
             SDL_Log("[client] destryed minion\n");
-        m->active = false;
+        if (m->active)
+        {
+            m->active = false;
+            mm->activeMinionAmount--;
+            // Only the server plans waves, so only it collects slots to reuse
+            if (state.is_server)
+            {
+                mm->released_slots[mm->released_count++] = minionIndex;
+            }
+        }
     }
 }
 
 MinionManager MinionManager_Init(AppState *state)
 {
-    if (!state || !state->renderer || !state->entity_manager)
+    if (!state || !state->entity_manager)
     {
-        SDL_SetError("Invalid AppState or missing renderer/entity_manager for MinionManager_Init");
+        SDL_SetError("Invalid AppState or missing entity_manager for MinionManager_Init");
         return NULL;
     }
     MinionManager mm = (MinionManager)SDL_calloc(1, sizeof(struct MinionManager_s));
@@ -306,21 +466,12 @@ MinionManager MinionManager_Init(AppState *state)
     mm->activeMinionAmount = 0;
     mm->currentMinionWaveAmount = 0;
     mm->spawnNextMinion = false;
+    // The pool is allocated on the first spawn; clients adopt the server's limit on S_WELCOME
+    mm->max_minions = state->max_minions > 0 ? state->max_minions : MINION_DEFAULT_MAX;
 
-    mm->blue_texture = IMG_LoadTexture(state->renderer, BLUE_MINION_PATH);
-    mm->red_texture = IMG_LoadTexture(state->renderer, RED_MINION_PATH);
-
-    if (!mm->blue_texture || !mm->red_texture)
-    {
-        SDL_LogError(SDL_LOG_CATEGORY_ERROR, "[MinionManager Init] Failed load texture : %s", SDL_GetError());
-        SDL_free(mm);
-        return NULL;
-    }
-
-    for (int i = 0; i < MINION_MAX_AMOUNT; i++)
-    {
-        mm->minions[i].active = false;
-    }
+    // Sprites are NULL without a renderer (dedicated server)
+    mm->blue_sprite = TextureAtlas_Get(state->texture_atlas, ATLAS_SPRITE_MINION_BLUE);
+    mm->red_sprite = TextureAtlas_Get(state->texture_atlas, ATLAS_SPRITE_MINION_RED);
 
     EntityFunctions minion_funcs = {
         .name = "minion_manager",
@@ -332,9 +483,6 @@ MinionManager MinionManager_Init(AppState *state)
     if (!EntityManager_Add(state->entity_manager, &minion_funcs))
     {
         SDL_LogError(SDL_LOG_CATEGORY_ERROR, "[MinionManager Init] Failed to add entity to manager: %s", SDL_GetError());
-        if (mm->red_texture || mm->red_texture)
-            SDL_DestroyTexture(mm->red_texture);
-        SDL_DestroyTexture(mm->blue_texture);
         SDL_free(mm);
         return NULL;
     }
@@ -346,8 +494,9 @@ void MinionManager_Destroy(MinionManager mm)
 {
     if (mm)
     {
-        mm->blue_texture = NULL;
-        mm->red_texture = NULL;
+        SDL_free(mm->minions);
+        SDL_free(mm->free_slots);
+        SDL_free(mm->released_slots);
         SDL_free(mm);
         SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "MinonManager state container destroyed.");
     }
@@ -355,6 +504,8 @@ void MinionManager_Destroy(MinionManager mm)
 
 bool MinionManager_GetMinionPosition(MinionManager mm, int minionIndex, SDL_FPoint *out_pos)
 {
+    if (!mm || minionIndex < 0 || minionIndex >= mm->minion_capacity)
+        return false;
     MinionData minion = mm->minions[minionIndex];
     if (!minion.active)
     {
@@ -363,4 +514,35 @@ bool MinionManager_GetMinionPosition(MinionManager mm, int minionIndex, SDL_FPoi
 
     *out_pos = minion.position;
     return true;
+}
+
+bool MinionManager_QueueWave(MinionManager mm, const Msg_MinionWaveData *wave)
+{
+    if (!mm || !wave)
+        return SDL_SetError("Invalid arguments for MinionManager_QueueWave");
+    if (mm->wave_plan_count == MINION_WAVE_PLAN_QUEUE)
+        return SDL_SetError("Minion wave queue is full, wave %u dropped", (unsigned int)wave->wave);
+    if (wave->wave != mm->next_wave)
+    {
+        SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[MinionManager] Expected wave %u, got wave %u.", (unsigned int)mm->next_wave, (unsigned int)wave->wave);
+    }
+
+    MinionWavePlan *plan = &mm->wave_plans[(mm->wave_plan_head + mm->wave_plan_count) % MINION_WAVE_PLAN_QUEUE];
+    plan->wave = wave->wave;
+    plan->slot_count = SDL_min(wave->count, MINION_WAVE_SLOTS) & ~1;
+    for (int i = 0; i < plan->slot_count; ++i)
+    {
+        plan->slots[i] = wave->slots[i];
+    }
+    mm->wave_plan_count++;
+    mm->next_wave = (Uint16)(wave->wave + 1);
+    return true;
+}
+
+void MinionManager_SetMaxMinions(MinionManager mm, int max_minions)
+{
+    if (!mm || max_minions <= 0)
+        return;
+    mm->max_minions = max_minions;
+    SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "MinionManager limit set to %d minions.", max_minions);
 }
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "../include/net_client.h"
+#include "../include/asset_loader.h"
 
 // --- Internal Structures ---
 
@@ -13,6 +14,17 @@ typedef enum ClientNetworkStatus
     CLIENT_STATUS_CONNECTED     /**< Actively connected to the server. */
 } ClientNetworkStatus;
 
+#define TIME_SYNC_SAMPLES 8 /**< Recent ping/pong samples the clock estimate is picked from. */
+
+/**
+ * @brief One ping/pong round trip.
+ */
+typedef struct TimeSyncSample
+{
+    Uint32 rtt_ms;    /**< Round-trip time of the ping. */
+    Sint64 offset_ms; /**< Server clock minus ours, assuming the pong took half the round trip. */
+} TimeSyncSample;
+
 /**
  * @brief Internal state for the NetClient module.
  */
@@ -24,38 +36,101 @@ struct NetClientState_s
     int my_client_id;                        /**< Client ID assigned by the server, or -1 if not assigned. */
     Uint64 last_state_send_time;             /**< Timestamp of the last player state message sent. */
     char hostname[MAX_NAME_LENGTH];          /**< Hostname to connect to, provided by the user or default. */
+    Uint16 room_id;                          /**< Room requested in C_HELLO, from --room. */
+    bool team;                               /**< Team announced in C_HELLO, from --team. */
+    NetRecvBuffer recv_buffer;               /**< Accumulates stream bytes until complete frames are available. */
+    NetSendQueue send_queue;                 /**< Frames produced this tick, written in one call at the end of the update pass. */
+    bool send_failed;                        /**< Set when queueing fails; the connection is torn down on the next flush. */
+    NetDeltaSender state_tx;                 /**< Local player states sent to the server. */
+    NetDeltaReceiver remote_state_rx[MAX_CLIENTS]; /**< Remote player states received, indexed by client ID. */
+    SDLNet_DatagramSocket *udp_socket;       /**< Unreliable channel for player state, or NULL until welcomed. */
+    uint32_t session_token;                  /**< Token from S_WELCOME, echoed in C_UDP_HELLO. */
+    bool udp_ready;                          /**< Set once the server has bound our datagram endpoint. */
+    Uint64 last_udp_hello_time;              /**< Timestamp of the last C_UDP_HELLO sent. */
+    int udp_hello_attempts;                  /**< Number of C_UDP_HELLO sent without an S_UDP_READY. */
+    bool remote_ack_pending[MAX_CLIENTS];    /**< A remote player state arrived over UDP and has not been acknowledged yet. */
+    Uint16 last_sent_input_seq;              /**< Newest input command sent to the server. */
+    bool has_sent_input;                     /**< False until an input command has been sent on this connection. */
+    Uint64 last_time_ping_time;              /**< Timestamp of the last C_TIME_PING sent. */
+    int time_pings_sent;                     /**< C_TIME_PING sent on this connection; the first few go out quickly. */
+    TimeSyncSample time_samples[TIME_SYNC_SAMPLES]; /**< Newest round trips, used as a ring. */
+    int time_sample_count;                   /**< Number of valid samples. */
+    int time_sample_next;                    /**< Ring index the next sample is written to. */
+    bool start_pending;                      /**< S_GAME_START arrived while assets were still loading. */
 };
 
 // --- Constants ---
-const Uint32 STATE_UPDATE_INTERVAL_MS = 50; /**< Interval (ms) for sending player state updates. */
+const Uint32 UDP_HELLO_INTERVAL_MS = 250;   /**< Interval (ms) between C_UDP_HELLO retries. */
+const int UDP_HELLO_MAX_ATTEMPTS = 20;      /**< Give up on UDP and stay on TCP after this many unanswered hellos. */
+const Uint32 TIME_SYNC_INTERVAL_MS = 1000;  /**< Interval (ms) between C_TIME_PING once the clock has settled. */
+const Uint32 TIME_SYNC_FAST_INTERVAL_MS = 100; /**< Interval (ms) between the first few C_TIME_PING of a connection. */
+const int TIME_SYNC_FAST_PINGS = 5;         /**< Pings sent quickly after joining, so the clock is good before the match starts. */
 
 // --- Static Helper Functions ---
 
 /**
- * @brief Sends a data buffer to the server.
- * Handles potential disconnect on send failure.
+ * @brief Queues a data buffer for the server.
+ * The message is written together with everything else queued this tick when the client flushes.
+ * A failure marks the connection for teardown at the next flush.
  * @param nc_state The NetClientState instance.
  * @param buffer Pointer to the data buffer to send.
  * @param length The number of bytes to send from the buffer.
- * @return True if the send was successful, false otherwise (indicates disconnect).
+ * @return True if the message was queued, false otherwise (indicates disconnect).
  */
 static bool NetClient_SendBuffer(NetClientState nc_state, const void *buffer, int length)
 {
-    if (!nc_state || nc_state->network_status != CLIENT_STATUS_CONNECTED || !nc_state->server_connection)
+    if (!nc_state || nc_state->network_status != CLIENT_STATUS_CONNECTED || !nc_state->server_connection || nc_state->send_failed)
     {
         return false;
     }
-    if (!SDLNet_WriteToStreamSocket(nc_state->server_connection, buffer, length))
+    if (!NetFrame_QueueFrame(&nc_state->send_queue, nc_state->server_connection, buffer, length))
     {
         SDL_LogError(SDL_LOG_CATEGORY_ERROR, "[Client] Send failed: %s. Disconnecting.", SDL_GetError());
-        NetClient_Destroy(nc_state); // Trigger full cleanup on send failure
-        // If AppState is accessible here, nullify its pointer too
+        nc_state->send_failed = true; // Torn down in the late update, where AppState is available
         return false;
     }
 
     return true;
 }
 
+/**
+ * @brief Sends a single datagram to the server's datagram port.
+ * @param nc_state The NetClientState instance.
+ * @param buffer Pointer to the data buffer to send.
+ * @param length The number of bytes to send from the buffer.
+ * @return True if the datagram was handed to the OS, false on failure.
+ */
+static bool internal_send_datagram(NetClientState nc_state, const void *buffer, int length)
+{
+    if (!nc_state->udp_socket || !nc_state->server_address_resolved)
+    {
+        return false;
+    }
+    if (!SDLNet_SendDatagram(nc_state->udp_socket, nc_state->server_address_resolved, SERVER_PORT, buffer, length))
+    {
+        SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Client] Datagram send failed: %s", SDL_GetError());
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Closes the datagram channel so player state goes back to the stream.
+ * @param nc_state The NetClientState instance.
+ */
+static void internal_close_udp(NetClientState nc_state)
+{
+    if (nc_state->udp_socket)
+    {
+        SDLNet_DestroyDatagramSocket(nc_state->udp_socket);
+        nc_state->udp_socket = NULL;
+    }
+    nc_state->udp_ready = false;
+    nc_state->udp_hello_attempts = 0;
+    nc_state->last_udp_hello_time = 0;
+    SDL_zeroa(nc_state->remote_ack_pending);
+}
+
 /**
  * @brief Attempts to start resolving the server hostname asynchronously.
  * @param nc_state The NetClientState instance.
@@ -151,11 +226,29 @@ static void internal_check_connection_status(NetClientState nc_state)
     if (status == 1) // 1 indicates success
     {
         nc_state->network_status = CLIENT_STATUS_CONNECTED;
+        NetFrame_ResetRecvBuffer(&nc_state->recv_buffer);
+        NetFrame_ResetSendQueue(&nc_state->send_queue);
+        nc_state->send_failed = false;
+        NetDelta_ResetSender(&nc_state->state_tx);
+        nc_state->has_sent_input = false;
+        nc_state->time_pings_sent = 0;
+        nc_state->time_sample_count = 0;
+        nc_state->time_sample_next = 0;
+        for (int i = 0; i < MAX_CLIENTS; ++i)
+        {
+            NetDelta_ResetReceiver(&nc_state->remote_state_rx[i]);
+        }
+        internal_close_udp(nc_state);
         SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[Client] Connected to server!");
 
-        uint8_t msg_type = MSG_TYPE_C_HELLO;
-        SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[Client] Sending C_HELLO.");
-        if (!NetClient_SendBuffer(nc_state, &msg_type, sizeof(msg_type)))
+        Msg_HelloData hello;
+        hello.message_type = MSG_TYPE_C_HELLO;
+        hello.room_id = nc_state->room_id;
+        hello.team = nc_state->team;
+        Uint8 encoded[NET_CODEC_MAX_MESSAGE_SIZE];
+        int encoded_length = NetCodec_EncodeHello(&hello, encoded, sizeof(encoded));
+        SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[Client] Sending C_HELLO for room %u.", (unsigned int)hello.room_id);
+        if (encoded_length <= 0 || !NetClient_SendBuffer(nc_state, encoded, encoded_length))
         {
             return; // SendBuffer handles disconnect on failure
         }
@@ -171,6 +264,9 @@ static void internal_check_connection_status(NetClientState nc_state)
 
 /**
  * @brief Sends the local player's current state to the server.
+ * Only fields that changed since the last acknowledged state go on the wire; an unchanged player sends
+ * nothing except an occasional keepalive. Once the datagram channel is up the state goes over UDP and
+ * the server acknowledges it with S_STATE_ACK; until then it goes on the stream.
  * @param nc_state The NetClientState instance.
  * @param state The main AppState instance.
  */
@@ -187,7 +283,172 @@ static void internal_send_local_player_state(NetClientState nc_state, AppState *
         return;
     }
 
-    NetClient_SendBuffer(nc_state, &data, sizeof(Msg_PlayerStateData));
+    Uint64 now = SDL_GetTicks();
+    data.timestamp = (uint16_t)now; // Lets receivers space the states out as they were taken
+    Uint8 encoded[NET_CODEC_MAX_MESSAGE_SIZE];
+    Uint16 seq;
+    int encoded_length = NetDelta_EncodePlayerState(&nc_state->state_tx, &data, now, encoded, sizeof(encoded), &seq);
+    if (encoded_length <= 0)
+    {
+        return;
+    }
+    if (nc_state->udp_ready)
+    {
+        internal_send_datagram(nc_state, encoded, encoded_length); // Lost datagrams are simply superseded
+    }
+    else if (NetClient_SendBuffer(nc_state, encoded, encoded_length))
+    {
+        NetDelta_Ack(&nc_state->state_tx, seq); // The stream is reliable, so a queued state is a delivered state
+    }
+}
+
+/**
+ * @brief Sends the local player's input commands the server has not acknowledged yet.
+ * Over UDP every datagram repeats the newest unacknowledged commands, so a lost datagram is
+ * covered by the next one; on the stream each command is sent exactly once.
+ * Nothing is sent on ticks that produced no new command.
+ * @param nc_state The NetClientState instance.
+ * @param state The main AppState instance.
+ */
+static void internal_send_player_input(NetClientState nc_state, AppState *state)
+{
+    if (nc_state->my_client_id < 0 || !state->player_manager)
+        return;
+
+    PlayerInputCommand commands[MSG_PLAYER_INPUT_MAX_COMMANDS];
+    int count = PlayerManager_GetPendingInputs(state->player_manager, commands, MSG_PLAYER_INPUT_MAX_COMMANDS);
+    if (count == 0 || (nc_state->has_sent_input && !NetDelta_SeqNewer(commands[count - 1].seq, nc_state->last_sent_input_seq)))
+        return;
+
+    int first = 0;
+    if (!nc_state->udp_ready && nc_state->has_sent_input)
+    {
+        while (!NetDelta_SeqNewer(commands[first].seq, nc_state->last_sent_input_seq))
+            first++;
+    }
+
+    Msg_PlayerInputData msg;
+    msg.message_type = MSG_TYPE_C_PLAYER_INPUT;
+    msg.newest_seq = commands[count - 1].seq;
+    msg.count = (uint8_t)(count - first);
+    for (int i = first; i < count; ++i)
+    {
+        msg.buttons[i - first] = commands[i].buttons;
+    }
+
+    Uint8 encoded[NET_CODEC_MAX_MESSAGE_SIZE];
+    int encoded_length = NetCodec_EncodePlayerInput(&msg, encoded, sizeof(encoded));
+    if (encoded_length <= 0)
+        return;
+    if (nc_state->udp_ready)
+    {
+        internal_send_datagram(nc_state, encoded, encoded_length);
+    }
+    else if (!NetClient_SendBuffer(nc_state, encoded, encoded_length))
+    {
+        return;
+    }
+    nc_state->last_sent_input_seq = msg.newest_seq;
+    nc_state->has_sent_input = true;
+}
+
+/**
+ * @brief Asks the server for its clock, quickly after joining and then once per TIME_SYNC_INTERVAL_MS.
+ * A host shares its clock with the server it runs, so it never pings.
+ * @param nc_state The NetClientState instance.
+ * @param state The main AppState instance.
+ */
+static void internal_send_time_ping(NetClientState nc_state, AppState *state)
+{
+    if (nc_state->my_client_id < 0 || state->is_server)
+        return;
+
+    Uint64 current_time = SDL_GetTicks();
+    Uint32 interval = nc_state->time_pings_sent < TIME_SYNC_FAST_PINGS ? TIME_SYNC_FAST_INTERVAL_MS : TIME_SYNC_INTERVAL_MS;
+    if (nc_state->time_pings_sent > 0 && current_time < nc_state->last_time_ping_time + interval)
+        return;
+
+    Msg_TimePingData ping;
+    ping.message_type = MSG_TYPE_C_TIME_PING;
+    ping.client_time = current_time;
+    Uint8 encoded[NET_CODEC_MAX_MESSAGE_SIZE];
+    int encoded_length = NetCodec_EncodeTimePing(&ping, encoded, sizeof(encoded));
+    if (encoded_length <= 0)
+        return;
+    if (nc_state->udp_ready)
+    {
+        internal_send_datagram(nc_state, encoded, encoded_length);
+    }
+    else if (!NetClient_SendBuffer(nc_state, encoded, encoded_length))
+    {
+        return;
+    }
+    nc_state->time_pings_sent++;
+    nc_state->last_time_ping_time = current_time;
+}
+
+/**
+ * @brief Turns a pong into a round-trip sample and updates the clock estimate and RTT.
+ * The offset comes from the sample with the shortest round trip among the recent ones: queueing
+ * delay only ever lengthens a trip, and the shortest one has the least room to be lopsided.
+ * The shared clock then slews toward the estimate (see app_update).
+ * @param nc_state The NetClientState instance.
+ * @param state The main AppState instance.
+ * @param pong The received pong.
+ */
+static void internal_handle_time_pong(NetClientState nc_state, AppState *state, const Msg_TimePongData *pong)
+{
+    Uint64 current_time = SDL_GetTicks();
+    if (pong->client_time > current_time)
+        return;
+
+    TimeSyncSample *sample = &nc_state->time_samples[nc_state->time_sample_next];
+    sample->rtt_ms = (Uint32)(current_time - pong->client_time);
+    sample->offset_ms = (Sint64)(pong->server_time + sample->rtt_ms / 2) - (Sint64)current_time;
+    nc_state->time_sample_next = (nc_state->time_sample_next + 1) % TIME_SYNC_SAMPLES;
+    if (nc_state->time_sample_count < TIME_SYNC_SAMPLES)
+        nc_state->time_sample_count++;
+
+    const TimeSyncSample *best = &nc_state->time_samples[0];
+    for (int i = 1; i < nc_state->time_sample_count; ++i)
+    {
+        if (nc_state->time_samples[i].rtt_ms < best->rtt_ms)
+            best = &nc_state->time_samples[i];
+    }
+    state->clock_target_offset_ms = best->offset_ms;
+
+    // Smoothed like TCP's SRTT, so a single delayed pong barely moves it
+    if (nc_state->time_sample_count == 1)
+        state->rtt_ms = sample->rtt_ms;
+    else
+        state->rtt_ms = (Uint32)((Sint64)state->rtt_ms + ((Sint64)sample->rtt_ms - (Sint64)state->rtt_ms) / 8);
+
+    if (!state->clock_synced)
+    {
+        state->clock_offset_ms = state->clock_target_offset_ms;
+        state->sync_clock = 0; // Nothing runs on the clock before the first estimate, so it may jump back once
+        state->clock_synced = true;
+    }
+}
+
+/**
+ * @brief Switches to GAME_STATE_PLAYING after S_GAME_START once the AssetLoader is done.
+ * Until then the client stays in the lobby, still applying what the server sends.
+ * @param nc_state The NetClientState instance.
+ * @param state Pointer to the main AppState.
+ */
+static void internal_enter_match_when_loaded(NetClientState nc_state, AppState *state)
+{
+    if (!nc_state->start_pending || !AssetLoader_IsDone(state->asset_loader))
+        return;
+
+    nc_state->start_pending = false;
+    if (state->currentGameState != GAME_STATE_LOBBY)
+        return;
+
+    state->currentGameState = GAME_STATE_PLAYING;
+    // Hide lobby_client_msg after game start
+    update_hud_instance(state, get_hud_index_by_name(state, "lobby_client_msg"), "", (SDL_Color){255, 255, 255, 255}, (SDL_FPoint){0.0f, 50.0f}, 0);
 }
 
 /**
@@ -215,32 +476,48 @@ static void internal_process_server_message(NetClientState nc_state, char *buffe
             SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Client] Received duplicate S_WELCOME (myID already %d). Ignoring.", nc_state->my_client_id);
             return;
         }
-        if (bytesReceived >= (int)sizeof(Msg_WelcomeData))
+        Msg_WelcomeData welcome_data;
+        if (NetCodec_DecodeWelcome(buffer, bytesReceived, &welcome_data))
         {
-            Msg_WelcomeData welcome_data;
-            memcpy(&welcome_data, buffer, sizeof(Msg_WelcomeData));
             nc_state->my_client_id = welcome_data.assigned_client_id;
+            nc_state->session_token = welcome_data.session_token;
             SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[Client] Received S_WELCOME, assigned myClientID = %d", nc_state->my_client_id);
+
+            // Minions and attacks are addressed by index and ID, so every peer uses the server's pool limits
+            state->max_minions = welcome_data.max_minions;
+            state->max_attacks = welcome_data.max_attacks;
+            MinionManager_SetMaxMinions(state->minion_manager, state->max_minions);
+            AttackManager_SetMaxAttacks(state->attack_manager, state->max_attacks);
+
+            nc_state->udp_socket = SDLNet_CreateDatagramSocket(NULL, 0);
+            if (!nc_state->udp_socket)
+            {
+                SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Client] SDLNet_CreateDatagramSocket failed: %s. Player state will use TCP only.", SDL_GetError());
+            }
         }
         else
         {
-            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Client] Rcvd incomplete S_WELCOME (%d bytes, needed %lu)", bytesReceived, (unsigned long)sizeof(Msg_WelcomeData));
+            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Client] Rcvd truncated S_WELCOME (%d bytes)", bytesReceived);
         }
         break;
 
     case MSG_TYPE_S_GAME_START:
         SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[Client] Received S_GAME_START, assigned myClientID = %d", nc_state->my_client_id);
-        state->currentGameState = GAME_STATE_PLAYING;
-        if (bytesReceived >= (int)sizeof(Msg_GameStart))
+        Msg_GameStart data;
+        if (NetCodec_DecodeGameStart(buffer, bytesReceived, &data))
         {
-            Msg_GameStart data;
-            memcpy(&data, buffer, sizeof(Msg_GameStart));
-            state->server_start_time = data.server_start_time_stamp;
-            state->client_start_time = SDL_GetTicks();
+            // Without any pong yet, this is the best estimate there is (it trails by the one-way latency)
+            if (!state->clock_synced)
+            {
+                state->clock_offset_ms = (Sint64)data.server_start_time_stamp - (Sint64)SDL_GetTicks();
+                state->clock_target_offset_ms = state->clock_offset_ms;
+                state->sync_clock = 0;
+                state->clock_synced = true;
+            }
         }
         else
         {
-            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Client] Rcvd incomplete S_GAME_START (%d bytes, needed %lu)", bytesReceived, (unsigned long)sizeof(Msg_GameStart));
+            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Client] Rcvd truncated S_GAME_START (%d bytes)", bytesReceived);
         }
 
         if (!state->player_manager || !state->camera_state)
@@ -255,16 +532,19 @@ static void internal_process_server_message(NetClientState nc_state, char *buffe
             NetClient_Destroy(nc_state);
             return;
         }
-        // Hide lobby_client_msg after game start
-        update_hud_instance(state, get_hud_index_by_name(state, "lobby_client_msg"), "", (SDL_Color){255, 255, 255, 255}, (SDL_FPoint){0.0f, 50.0f}, 0);
-
+        // The lobby is left only once everything the match draws has been loaded
+        nc_state->start_pending = true;
+        internal_enter_match_when_loaded(nc_state, state);
         break;
 
     case MSG_TYPE_S_PLAYER_STATE:
-        if (bytesReceived >= (int)sizeof(Msg_PlayerStateData))
+    {
+        NetPlayerStateHeader header;
+        Msg_PlayerStateData state_data;
+        if (NetCodec_DecodePlayerStateHeader(buffer, bytesReceived, &header) && header.client_id < MAX_CLIENTS &&
+            NetDelta_DecodePlayerState(&nc_state->remote_state_rx[header.client_id], buffer, bytesReceived, &state_data))
         {
-            Msg_PlayerStateData state_data;
-            memcpy(&state_data, buffer, sizeof(Msg_PlayerStateData));
+            nc_state->remote_ack_pending[header.client_id] = nc_state->udp_ready;
             if (state->player_manager)
             {
                 PlayerManager_UpdateRemotePlayer(state, &state_data);
@@ -272,16 +552,74 @@ static void internal_process_server_message(NetClientState nc_state, char *buffe
         }
         else
         {
-            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Client] Rcvd incomplete S_PLAYER_STATE msg (%d bytes, needed %lu)", bytesReceived, (unsigned long)sizeof(Msg_PlayerStateData));
+            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Client] Dropped S_PLAYER_STATE msg (%d bytes): %s", bytesReceived, SDL_GetError());
+        }
+        break;
+    }
+
+    case MSG_TYPE_S_UDP_READY:
+        if (nc_state->udp_socket && !nc_state->udp_ready)
+        {
+            SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[Client] Datagram channel ready, sending player state over UDP.");
+            nc_state->udp_ready = true;
         }
         break;
 
+    case MSG_TYPE_S_STATE_ACK:
+    {
+        Msg_StateAckData ack_data;
+        if (NetCodec_DecodeStateAck(buffer, bytesReceived, &ack_data))
+        {
+            for (int i = 0; i < ack_data.count; ++i)
+            {
+                if (ack_data.entries[i].client_id == nc_state->my_client_id)
+                {
+                    NetDelta_Ack(&nc_state->state_tx, ack_data.entries[i].seq);
+                }
+            }
+        }
+        break;
+    }
+
+    case MSG_TYPE_S_INPUT_ACK:
+    {
+        Msg_InputAckData input_ack;
+        if (NetCodec_DecodeInputAck(buffer, bytesReceived, &input_ack))
+        {
+            PlayerManager_ReconcileLocalPlayer(state, input_ack.input_seq, input_ack.position);
+        }
+        else
+        {
+            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Client] Rcvd truncated S_INPUT_ACK msg (%d bytes)", bytesReceived);
+        }
+        break;
+    }
+
+    case MSG_TYPE_S_TIME_PONG:
+    {
+        Msg_TimePongData pong;
+        if (NetCodec_DecodeTimePong(buffer, bytesReceived, &pong))
+        {
+            internal_handle_time_pong(nc_state, state, &pong);
+        }
+        else
+        {
+            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Client] Rcvd truncated S_TIME_PONG msg (%d bytes)", bytesReceived);
+        }
+        break;
+    }
+
     case MSG_TYPE_S_PLAYER_DISCONNECT:
-        if (bytesReceived >= (int)sizeof(Msg_PlayerDisconnectData))
+    {
+        Msg_PlayerDisconnectData disconnect_data;
+        if (NetCodec_DecodePlayerDisconnect(buffer, bytesReceived, &disconnect_data))
         {
-            Msg_PlayerDisconnectData disconnect_data;
-            memcpy(&disconnect_data, buffer, sizeof(Msg_PlayerDisconnectData));
             SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[Client] Received disconnect for client %u", (unsigned int)disconnect_data.client_id);
+            if (disconnect_data.client_id < MAX_CLIENTS)
+            {
+                NetDelta_ResetReceiver(&nc_state->remote_state_rx[disconnect_data.client_id]);
+                nc_state->remote_ack_pending[disconnect_data.client_id] = false;
+            }
             if (state->player_manager)
             {
                 PlayerManager_RemovePlayer(state->player_manager, disconnect_data.client_id);
@@ -289,15 +627,16 @@ static void internal_process_server_message(NetClientState nc_state, char *buffe
         }
         else
         {
-            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Client] Rcvd incomplete S_PLAYER_DISCONNECT msg (%d bytes, needed %lu)", bytesReceived, (unsigned long)sizeof(Msg_PlayerDisconnectData));
+            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Client] Rcvd truncated S_PLAYER_DISCONNECT msg (%d bytes)", bytesReceived);
         }
         break;
+    }
 
     case MSG_TYPE_S_SPAWN_ATTACK:
-        if (bytesReceived >= (int)sizeof(Msg_ServerSpawnAttackData))
+    {
+        Msg_ServerSpawnAttackData spawn_data;
+        if (NetCodec_DecodeServerSpawnAttack(buffer, bytesReceived, &spawn_data))
         {
-            Msg_ServerSpawnAttackData spawn_data;
-            memcpy(&spawn_data, buffer, sizeof(Msg_ServerSpawnAttackData));
             if (state->attack_manager)
             {
                 AttackManager_HandleServerSpawn(state->attack_manager, &spawn_data);
@@ -305,15 +644,16 @@ static void internal_process_server_message(NetClientState nc_state, char *buffe
         }
         else
         {
-            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Client] Rcvd incomplete S_SPAWN_ATTACK msg (%d bytes, needed %lu)", bytesReceived, (unsigned long)sizeof(Msg_ServerSpawnAttackData));
+            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Client] Rcvd truncated S_SPAWN_ATTACK msg (%d bytes)", bytesReceived);
         }
         break;
+    }
 
     case MSG_TYPE_S_DESTROY_OBJECT:
-        if (bytesReceived >= (int)sizeof(Msg_DestroyObjectData))
+    {
+        Msg_DestroyObjectData destroy_data;
+        if (NetCodec_DecodeDestroyObject(buffer, bytesReceived, &destroy_data))
         {
-            Msg_DestroyObjectData destroy_data;
-            memcpy(&destroy_data, buffer, sizeof(Msg_DestroyObjectData));
             if (destroy_data.object_type == OBJECT_TYPE_ATTACK && state->attack_manager)
             {
                 AttackManager_HandleDestroyObject(state->attack_manager, &destroy_data);
@@ -321,15 +661,16 @@ static void internal_process_server_message(NetClientState nc_state, char *buffe
         }
         else
         {
-            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Client] Rcvd incomplete S_DESTROY_OBJECT msg (%d bytes, needed %lu)", bytesReceived, (unsigned long)sizeof(Msg_DestroyObjectData));
+            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Client] Rcvd truncated S_DESTROY_OBJECT msg (%d bytes)", bytesReceived);
         }
         break;
+    }
 
     case MSG_TYPE_S_DAMAGE_PLAYER:
-        if (bytesReceived >= (int)sizeof(Msg_DamagePlayer))
+    {
+        Msg_DamagePlayer state_data;
+        if (NetCodec_DecodeDamagePlayer(buffer, bytesReceived, &state_data))
         {
-            Msg_DamagePlayer state_data;
-            memcpy(&state_data, buffer, sizeof(Msg_DamagePlayer));
             if (state->player_manager)
             {
                 damagePlayer(*state, state_data.playerIndex, state_data.damageValue, false);
@@ -337,15 +678,16 @@ static void internal_process_server_message(NetClientState nc_state, char *buffe
         }
         else
         {
-            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Client] Rcvd incomplete S_DAMAGE_PLAYER msg (%d bytes, needed %lu)", bytesReceived, (unsigned long)sizeof(Msg_DamagePlayer));
+            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Client] Rcvd truncated S_DAMAGE_PLAYER msg (%d bytes)", bytesReceived);
         }
         break;
+    }
 
     case MSG_TYPE_S_DAMAGE_MINION:
-        if (bytesReceived >= (int)sizeof(Msg_DamageMinion))
+    {
+        Msg_DamageMinion state_data;
+        if (NetCodec_DecodeDamageMinion(buffer, bytesReceived, &state_data))
         {
-            Msg_DamageMinion state_data;
-            memcpy(&state_data, buffer, sizeof(Msg_DamageMinion));
             if (state->minion_manager)
             {
                 damageMinion(*state, state_data.minionIndex, 0, false, state_data.current_health);
@@ -353,15 +695,34 @@ static void internal_process_server_message(NetClientState nc_state, char *buffe
         }
         else
         {
-            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Client] Rcvd incomplete S_DAMAGE_MINION msg (%d bytes, needed %lu)", bytesReceived, (unsigned long)sizeof(Msg_DamageMinion));
+            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Client] Rcvd truncated S_DAMAGE_MINION msg (%d bytes)", bytesReceived);
+        }
+        break;
+    }
+
+    case MSG_TYPE_S_MINION_WAVE:
+    {
+        Msg_MinionWaveData wave_data;
+        if (NetCodec_DecodeMinionWave(buffer, bytesReceived, &wave_data))
+        {
+            // A host's MinionManager queued the wave when it planned it
+            if (state->minion_manager && !state->is_server && !MinionManager_QueueWave(state->minion_manager, &wave_data))
+            {
+                SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Client] %s", SDL_GetError());
+            }
+        }
+        else
+        {
+            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Client] Rcvd truncated S_MINION_WAVE msg (%d bytes)", bytesReceived);
         }
         break;
+    }
 
     case MSG_TYPE_S_DAMAGE_TOWER:
-        if (bytesReceived >= (int)sizeof(Msg_DamageTower))
+    {
+        Msg_DamageTower state_data;
+        if (NetCodec_DecodeDamageTower(buffer, bytesReceived, &state_data))
         {
-            Msg_DamageTower state_data;
-            memcpy(&state_data, buffer, sizeof(Msg_DamageTower));
             if (state->tower_manager)
             {
                 damageTower(*state, state_data.towerIndex, state_data.damageValue, false, state_data.current_health);
@@ -369,15 +730,16 @@ static void internal_process_server_message(NetClientState nc_state, char *buffe
         }
         else
         {
-            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Client] Rcvd incomplete S_DAMAGE_TOWER msg (%d bytes, needed %lu)", bytesReceived, (unsigned long)sizeof(Msg_DamageTower));
+            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Client] Rcvd truncated S_DAMAGE_TOWER msg (%d bytes)", bytesReceived);
         }
         break;
+    }
 
     case MSG_TYPE_S_DAMAGE_BASE:
-        if (bytesReceived >= (int)sizeof(Msg_DamageBase))
+    {
+        Msg_DamageBase state_data;
+        if (NetCodec_DecodeDamageBase(buffer, bytesReceived, &state_data))
         {
-            Msg_DamageBase state_data;
-            memcpy(&state_data, buffer, sizeof(Msg_DamageBase));
             if (state->base_manager)
             {
                 damageBase(state, state_data.baseIndex, state_data.damageValue, false);
@@ -385,16 +747,16 @@ static void internal_process_server_message(NetClientState nc_state, char *buffe
         }
         else
         {
-            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Client] Rcvd incomplete S_DAMAGE_BASE msg (%d bytes, needed %lu)", bytesReceived, (unsigned long)sizeof(Msg_DamageBase));
+            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Client] Rcvd truncated S_DAMAGE_BASE msg (%d bytes)", bytesReceived);
         }
         break;
+    }
 
     case MSG_TYPE_S_GAME_RESULT:
-        if (bytesReceived >= (int)sizeof(Msg_MatchResult))
+    {
+        Msg_MatchResult received_match_result;
+        if (NetCodec_DecodeMatchResult(buffer, bytesReceived, &received_match_result))
         {
-            Msg_MatchResult received_match_result;
-            memcpy(&received_match_result, buffer, sizeof(Msg_MatchResult));
-
             SDL_Log("\n---\nMatch Won by team %s\n---\n", received_match_result.winningTeam ? "RED" : "BLUE");
 
             state->winningTeam = received_match_result.winningTeam;
@@ -403,9 +765,10 @@ static void internal_process_server_message(NetClientState nc_state, char *buffe
         }
         else
         {
-            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Client] Rcvd incomplete S_GAME_RESULT msg (%d bytes, needed %lu)", bytesReceived, (unsigned long)sizeof(Msg_MatchResult));
+            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Client] Rcvd truncated S_GAME_RESULT msg (%d bytes)", bytesReceived);
         }
         break;
+    }
 
     default:
         SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Client] Rcvd unknown message type (%u) from server", (unsigned int)msg_type_byte);
@@ -414,8 +777,8 @@ static void internal_process_server_message(NetClientState nc_state, char *buffe
 }
 
 /**
- * @brief Reads available data from the server socket and processes messages.
- * Handles disconnects if reads fail.
+ * @brief Reads available data from the server socket and dispatches every complete frame received.
+ * Handles disconnects if reads fail or the stream is corrupt.
  * @param nc_state The NetClientState instance.
  * @param state The main AppState instance.
  * @return True if the connection is still active after reading, false if disconnected.
@@ -427,26 +790,42 @@ static bool internal_receive_server_data(NetClientState nc_state, AppState *stat
         return false;
     }
 
-    char buffer[BUFFER_SIZE];
+    char payload[NET_FRAME_MAX_PAYLOAD];
     int bytesReceived;
+    int frameLength = 0;
     SDL_ClearError();
 
     // Read all available data in the socket buffer for this frame
-    while ((bytesReceived = SDLNet_ReadFromStreamSocket(nc_state->server_connection, buffer, sizeof(buffer))) > 0)
+    while ((bytesReceived = NetFrame_ReadFromSocket(&nc_state->recv_buffer, nc_state->server_connection)) >= 0)
     {
-        internal_process_server_message(nc_state, buffer, bytesReceived, state);
-        // Check if processing caused a disconnect (e.g., critical error)
-        if (nc_state->network_status != CLIENT_STATUS_CONNECTED)
+        // Dispatch every complete frame currently buffered
+        while ((frameLength = NetFrame_PopFrame(&nc_state->recv_buffer, payload, sizeof(payload))) > 0)
         {
-            return false;
+            internal_process_server_message(nc_state, payload, frameLength, state);
+            // Check if processing caused a disconnect (e.g., critical error)
+            if (nc_state->network_status != CLIENT_STATUS_CONNECTED)
+            {
+                return false;
+            }
         }
-        // Stop reading if the buffer wasn't filled, indicating no more immediate data
-        if (bytesReceived < (int)sizeof(buffer))
+        // Stop once the socket has nothing more for us or the stream is corrupt
+        if (bytesReceived == 0 || frameLength < 0)
         {
             break;
         }
     }
 
+    if (frameLength < 0)
+    {
+        SDL_LogError(SDL_LOG_CATEGORY_ERROR, "[Client] Corrupt stream from server: %s. Disconnecting.", SDL_GetError());
+        NetClient_Destroy(nc_state);
+        if (state && state->net_client_state == nc_state)
+        {
+            state->net_client_state = NULL; // Nullify pointer in AppState
+        }
+        return false;
+    }
+
     // Handle read errors or closed connection
     if (bytesReceived < 0)
     {
@@ -474,9 +853,104 @@ static bool internal_receive_server_data(NetClientState nc_state, AppState *stat
     return true;
 }
 
+/**
+ * @brief Reads every pending datagram from the server and dispatches it.
+ * Only player state, state acks, input acks and time pongs travel over UDP, and only datagrams from the server's
+ * address are accepted. Stale player states are dropped by the sequence check in the delta receiver.
+ * @param nc_state The NetClientState instance.
+ * @param state The main AppState instance.
+ */
+static void internal_receive_server_datagrams(NetClientState nc_state, AppState *state)
+{
+    if (!nc_state->udp_socket)
+        return;
+
+    SDLNet_Datagram *datagram = NULL;
+    while (SDLNet_ReceiveDatagram(nc_state->udp_socket, &datagram) && datagram)
+    {
+        if (datagram->buflen > 0 && datagram->port == SERVER_PORT &&
+            SDLNet_CompareAddresses(datagram->addr, nc_state->server_address_resolved) == 0 &&
+            (datagram->buf[0] == MSG_TYPE_S_PLAYER_STATE || datagram->buf[0] == MSG_TYPE_S_STATE_ACK || datagram->buf[0] == MSG_TYPE_S_INPUT_ACK ||
+             datagram->buf[0] == MSG_TYPE_S_TIME_PONG))
+        {
+            internal_process_server_message(nc_state, (char *)datagram->buf, datagram->buflen, state);
+        }
+        SDLNet_DestroyDatagram(datagram);
+        datagram = NULL;
+    }
+}
+
+/**
+ * @brief Announces our datagram endpoint to the server until it confirms with S_UDP_READY.
+ * Hellos are retried because they may be lost; after too many the client stays on TCP.
+ * @param nc_state The NetClientState instance.
+ */
+static void internal_send_udp_hello(NetClientState nc_state)
+{
+    if (!nc_state->udp_socket || nc_state->udp_ready || nc_state->my_client_id < 0)
+        return;
+
+    Uint64 current_time = SDL_GetTicks();
+    if (nc_state->udp_hello_attempts > 0 && current_time < nc_state->last_udp_hello_time + UDP_HELLO_INTERVAL_MS)
+        return;
+
+    if (nc_state->udp_hello_attempts >= UDP_HELLO_MAX_ATTEMPTS)
+    {
+        SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Client] No answer to C_UDP_HELLO, player state will use TCP only.");
+        internal_close_udp(nc_state);
+        return;
+    }
+
+    Msg_UdpHelloData hello;
+    hello.message_type = MSG_TYPE_C_UDP_HELLO;
+    hello.client_id = (uint8_t)nc_state->my_client_id;
+    hello.session_token = nc_state->session_token;
+    Uint8 encoded[NET_CODEC_MAX_MESSAGE_SIZE];
+    int encoded_length = NetCodec_EncodeUdpHello(&hello, encoded, sizeof(encoded));
+    if (encoded_length > 0)
+    {
+        internal_send_datagram(nc_state, encoded, encoded_length);
+    }
+    nc_state->udp_hello_attempts++;
+    nc_state->last_udp_hello_time = current_time;
+}
+
+/**
+ * @brief Acknowledges the newest remote player states received over UDP this tick, in one datagram.
+ * @param nc_state The NetClientState instance.
+ */
+static void internal_send_state_acks(NetClientState nc_state)
+{
+    if (!nc_state->udp_ready)
+        return;
+
+    Msg_StateAckData ack;
+    ack.message_type = MSG_TYPE_C_STATE_ACK;
+    ack.count = 0;
+    for (int i = 0; i < MAX_CLIENTS && ack.count < MSG_STATE_ACK_MAX_ENTRIES; ++i)
+    {
+        if (nc_state->remote_ack_pending[i])
+        {
+            ack.entries[ack.count].client_id = (uint8_t)i;
+            ack.entries[ack.count].seq = nc_state->remote_state_rx[i].latest_seq;
+            ack.count++;
+            nc_state->remote_ack_pending[i] = false;
+        }
+    }
+    if (ack.count == 0)
+        return;
+
+    Uint8 encoded[NET_CODEC_MAX_MESSAGE_SIZE];
+    int encoded_length = NetCodec_EncodeStateAck(&ack, encoded, sizeof(encoded));
+    if (encoded_length > 0)
+    {
+        internal_send_datagram(nc_state, encoded, encoded_length);
+    }
+}
+
 /**
  * @brief Handles all communication logic when in the CONNECTED state.
- * Reads incoming data and sends outgoing player state updates periodically.
+ * Reads incoming stream data and datagrams and sends outgoing player state updates periodically.
  * @param nc_state The NetClientState instance.
  * @param state The main AppState instance.
  */
@@ -494,9 +968,13 @@ static void internal_handle_server_communication(NetClientState nc_state, AppSta
     if (nc_state->network_status != CLIENT_STATUS_CONNECTED)
         return;
 
+    internal_receive_server_datagrams(nc_state, state);
+    internal_send_udp_hello(nc_state);
+    internal_send_time_ping(nc_state, state);
+
     // Send state updates periodically
     Uint64 current_time = SDL_GetTicks();
-    if (nc_state->my_client_id >= 0 && current_time > nc_state->last_state_send_time + STATE_UPDATE_INTERVAL_MS)
+    if (nc_state->my_client_id >= 0 && current_time > nc_state->last_state_send_time + PLAYER_STATE_INTERVAL_MS)
     {
         internal_send_local_player_state(nc_state, state);
         // internal_send_local_minion_state(nc_state, state);
@@ -543,10 +1021,39 @@ static void net_client_update_callback(EntityManager manager, AppState *state)
         break;
     case CLIENT_STATUS_CONNECTED:
         internal_handle_server_communication(nc_state, state);
+        if (state->net_client_state)
+        {
+            internal_enter_match_when_loaded(nc_state, state);
+        }
         break;
     }
 }
 
+/**
+ * @brief Wrapper function conforming to EntityFunctions.late_update signature.
+ * Sends this tick's input command, writes every message queued during this tick to the
+ * server in one call, and acknowledges the player states that arrived over UDP.
+ * @param manager The EntityManager instance.
+ * @param state Pointer to the main AppState.
+ */
+static void net_client_late_update_callback(EntityManager manager, AppState *state)
+{
+    (void)manager; // Manager instance is not used in this specific implementation
+    NetClientState nc_state = state ? state->net_client_state : NULL;
+    if (!nc_state || nc_state->network_status != CLIENT_STATUS_CONNECTED)
+        return;
+
+    internal_send_player_input(nc_state, state);
+    if (nc_state->send_failed || !NetFrame_FlushSendQueue(&nc_state->send_queue, nc_state->server_connection))
+    {
+        SDL_LogError(SDL_LOG_CATEGORY_ERROR, "[Client] Flush failed: %s. Disconnecting.", SDL_GetError());
+        NetClient_Destroy(nc_state);
+        state->net_client_state = NULL; // Nullify pointer in AppState
+        return;
+    }
+    internal_send_state_acks(nc_state);
+}
+
 /**
  * @brief Wrapper function conforming to EntityFunctions.cleanup signature.
  * @param manager The EntityManager instance.
@@ -582,6 +1089,8 @@ NetClientState NetClient_Init(AppState *state, const char *hostname)
     // Copy the provided hostname to the struct
     strncpy(nc_state->hostname, hostname, MAX_NAME_LENGTH - 1);
     nc_state->hostname[MAX_NAME_LENGTH - 1] = '\0'; // Ensure null-termination
+    nc_state->room_id = state->room_id;
+    nc_state->team = state->team;
 
     nc_state->network_status = CLIENT_STATUS_DISCONNECTED;
     nc_state->server_address_resolved = NULL;
@@ -592,6 +1101,7 @@ NetClientState NetClient_Init(AppState *state, const char *hostname)
     EntityFunctions net_client_funcs = {
         .name = "net_client",
         .update = net_client_update_callback,
+        .late_update = net_client_late_update_callback,
         .cleanup = net_client_cleanup_callback,
         .render = NULL,
         .handle_events = NULL};
@@ -615,9 +1125,14 @@ void NetClient_Destroy(NetClientState nc_state)
     SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "Destroying NetClientState...");
     if (nc_state->server_connection != NULL)
     {
+        if (nc_state->network_status == CLIENT_STATUS_CONNECTED && !nc_state->send_failed)
+        {
+            NetFrame_FlushSendQueue(&nc_state->send_queue, nc_state->server_connection); // Best effort
+        }
         SDLNet_DestroyStreamSocket(nc_state->server_connection);
         nc_state->server_connection = NULL;
     }
+    internal_close_udp(nc_state);
     if (nc_state->server_address_resolved != NULL)
     {
         SDLNet_UnrefAddress(nc_state->server_address_resolved);
@@ -654,7 +1169,9 @@ bool NetClient_SendSpawnAttackRequest(NetClientState nc_state, AttackType type,
     msg.target_pos.y = target_world_y;
     msg.team = team;
 
-    return NetClient_SendBuffer(nc_state, &msg, sizeof(Msg_ClientSpawnAttackData));
+    Uint8 encoded[NET_CODEC_MAX_MESSAGE_SIZE];
+    int encoded_length = NetCodec_EncodeClientSpawnAttack(&msg, encoded, sizeof(encoded));
+    return encoded_length > 0 && NetClient_SendBuffer(nc_state, encoded, encoded_length);
 }
 
 bool NetClient_SendDamagePlayerRequest(NetClientState nc_state, int playerIndex, float damageValue)
@@ -669,7 +1186,9 @@ bool NetClient_SendDamagePlayerRequest(NetClientState nc_state, int playerIndex,
     msg.playerIndex = playerIndex;
     msg.damageValue = damageValue;
 
-    return NetClient_SendBuffer(nc_state, &msg, sizeof(Msg_DamagePlayer));
+    Uint8 encoded[NET_CODEC_MAX_MESSAGE_SIZE];
+    int encoded_length = NetCodec_EncodeDamagePlayer(&msg, encoded, sizeof(encoded));
+    return encoded_length > 0 && NetClient_SendBuffer(nc_state, encoded, encoded_length);
 }
 
 bool NetClient_SendDamageMinionRequest(NetClientState nc_state, int minionIndex, float sentCurrentHealth)
@@ -682,7 +1201,9 @@ bool NetClient_SendDamageMinionRequest(NetClientState nc_state, int minionIndex,
     msg.message_type = MSG_TYPE_C_DAMAGE_MINION;
     msg.minionIndex = minionIndex;
     msg.current_health = sentCurrentHealth;
-    return NetClient_SendBuffer(nc_state, &msg, sizeof(Msg_DamageMinion));
+    Uint8 encoded[NET_CODEC_MAX_MESSAGE_SIZE];
+    int encoded_length = NetCodec_EncodeDamageMinion(&msg, encoded, sizeof(encoded));
+    return encoded_length > 0 && NetClient_SendBuffer(nc_state, encoded, encoded_length);
 }
 
 bool NetClient_SendDamageTowerRequest(NetClientState nc_state, int towerIndex, float damageValue, float current_health)
@@ -698,7 +1219,9 @@ bool NetClient_SendDamageTowerRequest(NetClientState nc_state, int towerIndex, f
     msg.damageValue = damageValue;
     msg.current_health = current_health;
 
-    return NetClient_SendBuffer(nc_state, &msg, sizeof(Msg_DamageTower));
+    Uint8 encoded[NET_CODEC_MAX_MESSAGE_SIZE];
+    int encoded_length = NetCodec_EncodeDamageTower(&msg, encoded, sizeof(encoded));
+    return encoded_length > 0 && NetClient_SendBuffer(nc_state, encoded, encoded_length);
 }
 
 bool NetClient_SendDamageBaseRequest(NetClientState nc_state, int baseIndex, float damageValue)
@@ -713,7 +1236,9 @@ bool NetClient_SendDamageBaseRequest(NetClientState nc_state, int baseIndex, flo
     msg.baseIndex = baseIndex;
     msg.damageValue = damageValue;
 
-    return NetClient_SendBuffer(nc_state, &msg, sizeof(Msg_DamageBase));
+    Uint8 encoded[NET_CODEC_MAX_MESSAGE_SIZE];
+    int encoded_length = NetCodec_EncodeDamageBase(&msg, encoded, sizeof(encoded));
+    return encoded_length > 0 && NetClient_SendBuffer(nc_state, encoded, encoded_length);
 }
 
 bool NetClient_SendMatchResult(NetClientState nc_state, bool winningTeam)
@@ -729,5 +1254,7 @@ bool NetClient_SendMatchResult(NetClientState nc_state, bool winningTeam)
 
     SDL_Log("NetClient_SendMatchResult %d", msg.winningTeam);
 
-    return NetClient_SendBuffer(nc_state, &msg, sizeof(Msg_MatchResult));
-}
\ No newline at end of file
+    Uint8 encoded[NET_CODEC_MAX_MESSAGE_SIZE];
+    int encoded_length = NetCodec_EncodeMatchResult(&msg, encoded, sizeof(encoded));
+    return encoded_length > 0 && NetClient_SendBuffer(nc_state, encoded, encoded_length);
+}
\ No newline at end of file
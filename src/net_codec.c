@@ -0,0 +1,753 @@
+#include "../include/net_codec.h"
+
+// --- Constants ---
+#define NET_POSITION_SCALE ((float)(1 << NET_CODEC_POSITION_FRACTION_BITS))
+
+#define FLAG_FLIPPED 0x01 /**< Sprite is mirrored horizontally. */
+#define FLAG_TEAM 0x02    /**< Entity belongs to the red team. */
+
+#define PLAYER_STATE_HEADER_SIZE 9 /**< type, client_id, seq, baseline_seq, timestamp, field_mask. */
+
+// --- Static Helper Functions ---
+
+/**
+ * @brief Reserves space in the writer's buffer.
+ * @param w The writer.
+ * @param size Number of bytes needed.
+ * @return Pointer to the reserved bytes, or NULL if they do not fit.
+ */
+static Uint8 *writer_reserve(NetWriter *w, int size)
+{
+    if (w->overflow || w->length + size > w->capacity)
+    {
+        w->overflow = true;
+        return NULL;
+    }
+    Uint8 *p = &w->data[w->length];
+    w->length += size;
+    return p;
+}
+
+/**
+ * @brief Consumes bytes from the reader's buffer.
+ * @param r The reader.
+ * @param size Number of bytes needed.
+ * @return Pointer to the consumed bytes, or NULL if the message is too short.
+ */
+static const Uint8 *reader_take(NetReader *r, int size)
+{
+    if (r->overflow || r->offset + size > r->length)
+    {
+        r->overflow = true;
+        return NULL;
+    }
+    const Uint8 *p = &r->data[r->offset];
+    r->offset += size;
+    return p;
+}
+
+/**
+ * @brief Converts one world coordinate to unsigned fixed point, clamped to the representable range.
+ * @param value The coordinate in pixels.
+ * @return The quantized coordinate.
+ */
+static Uint16 quantize_coordinate(float value)
+{
+    float scaled = value * NET_POSITION_SCALE + 0.5f;
+    if (!(scaled > 0.0f)) // Also catches NaN
+        return 0;
+    if (scaled >= 65535.0f)
+        return 65535;
+    return (Uint16)scaled;
+}
+
+/**
+ * @brief Packs the flip and team state of a player into a flags byte.
+ * @param msg The player state.
+ * @return The FLAG_* bit set.
+ */
+static Uint8 player_state_flags(const Msg_PlayerStateData *msg)
+{
+    Uint8 flags = 0;
+    if (msg->flip_mode == SDL_FLIP_HORIZONTAL)
+        flags |= FLAG_FLIPPED;
+    if (msg->team)
+        flags |= FLAG_TEAM;
+    return flags;
+}
+
+/**
+ * @brief Finishes an encode call, reporting overflow as an error.
+ * @param w The writer used for encoding.
+ * @return Encoded length, or -1 if the output buffer was too small.
+ */
+static int finish_encode(const NetWriter *w)
+{
+    if (w->overflow)
+    {
+        SDL_SetError("Output buffer too small for message (%d bytes)", w->capacity);
+        return -1;
+    }
+    return w->length;
+}
+
+// --- Public API Function Implementations ---
+
+void NetWriter_Init(NetWriter *w, void *buffer, int capacity)
+{
+    w->data = (Uint8 *)buffer;
+    w->capacity = buffer ? capacity : 0;
+    w->length = 0;
+    w->overflow = false;
+}
+
+void NetWriter_U8(NetWriter *w, Uint8 value)
+{
+    Uint8 *p = writer_reserve(w, 1);
+    if (p)
+        p[0] = value;
+}
+
+void NetWriter_U16(NetWriter *w, Uint16 value)
+{
+    Uint8 *p = writer_reserve(w, 2);
+    if (p)
+    {
+        p[0] = (Uint8)(value & 0xFF);
+        p[1] = (Uint8)(value >> 8);
+    }
+}
+
+void NetWriter_I16(NetWriter *w, Sint16 value)
+{
+    NetWriter_U16(w, (Uint16)value);
+}
+
+void NetWriter_U32(NetWriter *w, Uint32 value)
+{
+    Uint8 *p = writer_reserve(w, 4);
+    if (p)
+    {
+        for (int i = 0; i < 4; ++i)
+            p[i] = (Uint8)(value >> (8 * i));
+    }
+}
+
+void NetWriter_U64(NetWriter *w, Uint64 value)
+{
+    Uint8 *p = writer_reserve(w, 8);
+    if (p)
+    {
+        for (int i = 0; i < 8; ++i)
+            p[i] = (Uint8)(value >> (8 * i));
+    }
+}
+
+void NetWriter_F32(NetWriter *w, float value)
+{
+    Uint32 bits;
+    memcpy(&bits, &value, sizeof(bits)); // IEEE-754 bit pattern, sent little-endian
+    NetWriter_U32(w, bits);
+}
+
+void NetWriter_Position(NetWriter *w, SDL_FPoint value)
+{
+    NetWriter_U16(w, quantize_coordinate(value.x));
+    NetWriter_U16(w, quantize_coordinate(value.y));
+}
+
+void NetReader_Init(NetReader *r, const void *buffer, int length)
+{
+    r->data = (const Uint8 *)buffer;
+    r->length = buffer ? length : 0;
+    r->offset = 0;
+    r->overflow = false;
+}
+
+Uint8 NetReader_U8(NetReader *r)
+{
+    const Uint8 *p = reader_take(r, 1);
+    return p ? p[0] : 0;
+}
+
+Uint16 NetReader_U16(NetReader *r)
+{
+    const Uint8 *p = reader_take(r, 2);
+    return p ? (Uint16)(p[0] | (p[1] << 8)) : 0;
+}
+
+Sint16 NetReader_I16(NetReader *r)
+{
+    return (Sint16)NetReader_U16(r);
+}
+
+Uint32 NetReader_U32(NetReader *r)
+{
+    const Uint8 *p = reader_take(r, 4);
+    if (!p)
+        return 0;
+    Uint32 value = 0;
+    for (int i = 0; i < 4; ++i)
+        value |= (Uint32)p[i] << (8 * i);
+    return value;
+}
+
+Uint64 NetReader_U64(NetReader *r)
+{
+    const Uint8 *p = reader_take(r, 8);
+    if (!p)
+        return 0;
+    Uint64 value = 0;
+    for (int i = 0; i < 8; ++i)
+        value |= (Uint64)p[i] << (8 * i);
+    return value;
+}
+
+float NetReader_F32(NetReader *r)
+{
+    Uint32 bits = NetReader_U32(r);
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+SDL_FPoint NetReader_Position(NetReader *r)
+{
+    SDL_FPoint value;
+    value.x = (float)NetReader_U16(r) / NET_POSITION_SCALE;
+    value.y = (float)NetReader_U16(r) / NET_POSITION_SCALE;
+    return value;
+}
+
+// --- Encoders ---
+
+int NetCodec_EncodeHello(const Msg_HelloData *msg, void *out, int out_size)
+{
+    NetWriter w;
+    NetWriter_Init(&w, out, out_size);
+    NetWriter_U8(&w, msg->message_type);
+    NetWriter_U16(&w, msg->room_id);
+    NetWriter_U8(&w, msg->team ? FLAG_TEAM : 0);
+    return finish_encode(&w);
+}
+
+int NetCodec_EncodeWelcome(const Msg_WelcomeData *msg, void *out, int out_size)
+{
+    NetWriter w;
+    NetWriter_Init(&w, out, out_size);
+    NetWriter_U8(&w, msg->message_type);
+    NetWriter_U8(&w, msg->assigned_client_id);
+    NetWriter_U32(&w, msg->session_token);
+    NetWriter_U16(&w, msg->max_minions);
+    NetWriter_U16(&w, msg->max_attacks);
+    return finish_encode(&w);
+}
+
+int NetCodec_EncodeGameStart(const Msg_GameStart *msg, void *out, int out_size)
+{
+    NetWriter w;
+    NetWriter_Init(&w, out, out_size);
+    NetWriter_U8(&w, msg->message_type);
+    NetWriter_U64(&w, msg->server_start_time_stamp);
+    return finish_encode(&w);
+}
+
+int NetCodec_EncodePlayerDisconnect(const Msg_PlayerDisconnectData *msg, void *out, int out_size)
+{
+    NetWriter w;
+    NetWriter_Init(&w, out, out_size);
+    NetWriter_U8(&w, msg->message_type);
+    NetWriter_U8(&w, msg->client_id);
+    return finish_encode(&w);
+}
+
+int NetCodec_EncodeClientSpawnAttack(const Msg_ClientSpawnAttackData *msg, void *out, int out_size)
+{
+    NetWriter w;
+    NetWriter_Init(&w, out, out_size);
+    NetWriter_U8(&w, msg->message_type);
+    NetWriter_U8(&w, msg->attack_type);
+    NetWriter_Position(&w, msg->target_pos);
+    NetWriter_U8(&w, msg->team ? FLAG_TEAM : 0);
+    return finish_encode(&w);
+}
+
+int NetCodec_EncodeServerSpawnAttack(const Msg_ServerSpawnAttackData *msg, void *out, int out_size)
+{
+    NetWriter w;
+    NetWriter_Init(&w, out, out_size);
+    NetWriter_U8(&w, msg->message_type);
+    NetWriter_U8(&w, msg->attack_type);
+    NetWriter_U32(&w, msg->attack_id);
+    NetWriter_U8(&w, msg->owner_id);
+    NetWriter_Position(&w, msg->start_pos);
+    NetWriter_Position(&w, msg->target_pos);
+    NetWriter_F32(&w, msg->velocity.x); // Velocity is signed, so it stays a full float
+    NetWriter_F32(&w, msg->velocity.y);
+    NetWriter_U8(&w, (Uint8)msg->attacker);
+    NetWriter_U8(&w, msg->team ? FLAG_TEAM : 0);
+    return finish_encode(&w);
+}
+
+int NetCodec_EncodeDestroyObject(const Msg_DestroyObjectData *msg, void *out, int out_size)
+{
+    NetWriter w;
+    NetWriter_Init(&w, out, out_size);
+    NetWriter_U8(&w, msg->message_type);
+    NetWriter_U8(&w, msg->object_type);
+    NetWriter_U32(&w, msg->object_id);
+    return finish_encode(&w);
+}
+
+int NetCodec_EncodeDamagePlayer(const Msg_DamagePlayer *msg, void *out, int out_size)
+{
+    NetWriter w;
+    NetWriter_Init(&w, out, out_size);
+    NetWriter_U8(&w, msg->message_type);
+    NetWriter_U8(&w, (Uint8)msg->playerIndex);
+    NetWriter_F32(&w, msg->damageValue);
+    return finish_encode(&w);
+}
+
+int NetCodec_EncodeDamageMinion(const Msg_DamageMinion *msg, void *out, int out_size)
+{
+    NetWriter w;
+    NetWriter_Init(&w, out, out_size);
+    NetWriter_U8(&w, msg->message_type);
+    NetWriter_U16(&w, (Uint16)msg->minionIndex);
+    NetWriter_F32(&w, msg->current_health);
+    return finish_encode(&w);
+}
+
+int NetCodec_EncodeDamageTower(const Msg_DamageTower *msg, void *out, int out_size)
+{
+    NetWriter w;
+    NetWriter_Init(&w, out, out_size);
+    NetWriter_U8(&w, msg->message_type);
+    NetWriter_U8(&w, (Uint8)msg->towerIndex);
+    NetWriter_F32(&w, msg->damageValue);
+    NetWriter_F32(&w, msg->current_health);
+    return finish_encode(&w);
+}
+
+int NetCodec_EncodeDamageBase(const Msg_DamageBase *msg, void *out, int out_size)
+{
+    NetWriter w;
+    NetWriter_Init(&w, out, out_size);
+    NetWriter_U8(&w, msg->message_type);
+    NetWriter_U8(&w, (Uint8)msg->baseIndex);
+    NetWriter_F32(&w, msg->damageValue);
+    return finish_encode(&w);
+}
+
+int NetCodec_EncodeMatchResult(const Msg_MatchResult *msg, void *out, int out_size)
+{
+    NetWriter w;
+    NetWriter_Init(&w, out, out_size);
+    NetWriter_U8(&w, msg->message_type);
+    NetWriter_U8(&w, msg->winningTeam ? 1 : 0);
+    return finish_encode(&w);
+}
+
+int NetCodec_EncodeUdpHello(const Msg_UdpHelloData *msg, void *out, int out_size)
+{
+    NetWriter w;
+    NetWriter_Init(&w, out, out_size);
+    NetWriter_U8(&w, msg->message_type);
+    NetWriter_U8(&w, msg->client_id);
+    NetWriter_U32(&w, msg->session_token);
+    return finish_encode(&w);
+}
+
+int NetCodec_EncodeStateAck(const Msg_StateAckData *msg, void *out, int out_size)
+{
+    NetWriter w;
+    NetWriter_Init(&w, out, out_size);
+    Uint8 count = msg->count < MSG_STATE_ACK_MAX_ENTRIES ? msg->count : MSG_STATE_ACK_MAX_ENTRIES;
+    NetWriter_U8(&w, msg->message_type);
+    NetWriter_U8(&w, count);
+    for (int i = 0; i < count; ++i)
+    {
+        NetWriter_U8(&w, msg->entries[i].client_id);
+        NetWriter_U16(&w, msg->entries[i].seq);
+    }
+    return finish_encode(&w);
+}
+
+int NetCodec_EncodePlayerInput(const Msg_PlayerInputData *msg, void *out, int out_size)
+{
+    NetWriter w;
+    NetWriter_Init(&w, out, out_size);
+    Uint8 count = msg->count < MSG_PLAYER_INPUT_MAX_COMMANDS ? msg->count : MSG_PLAYER_INPUT_MAX_COMMANDS;
+    NetWriter_U8(&w, msg->message_type);
+    NetWriter_U16(&w, msg->newest_seq);
+    NetWriter_U8(&w, count);
+    for (int i = 0; i < count; ++i)
+    {
+        NetWriter_U8(&w, msg->buttons[i]);
+    }
+    return finish_encode(&w);
+}
+
+int NetCodec_EncodeInputAck(const Msg_InputAckData *msg, void *out, int out_size)
+{
+    NetWriter w;
+    NetWriter_Init(&w, out, out_size);
+    NetWriter_U8(&w, msg->message_type);
+    NetWriter_U16(&w, msg->input_seq);
+    NetWriter_Position(&w, msg->position);
+    return finish_encode(&w);
+}
+
+int NetCodec_EncodeTimePing(const Msg_TimePingData *msg, void *out, int out_size)
+{
+    NetWriter w;
+    NetWriter_Init(&w, out, out_size);
+    NetWriter_U8(&w, msg->message_type);
+    NetWriter_U64(&w, msg->client_time);
+    return finish_encode(&w);
+}
+
+int NetCodec_EncodeTimePong(const Msg_TimePongData *msg, void *out, int out_size)
+{
+    NetWriter w;
+    NetWriter_Init(&w, out, out_size);
+    NetWriter_U8(&w, msg->message_type);
+    NetWriter_U64(&w, msg->client_time);
+    NetWriter_U64(&w, msg->server_time);
+    return finish_encode(&w);
+}
+
+int NetCodec_EncodeMinionWave(const Msg_MinionWaveData *msg, void *out, int out_size)
+{
+    NetWriter w;
+    NetWriter_Init(&w, out, out_size);
+    Uint8 count = msg->count < MSG_MINION_WAVE_MAX_SLOTS ? msg->count : MSG_MINION_WAVE_MAX_SLOTS;
+    NetWriter_U8(&w, msg->message_type);
+    NetWriter_U16(&w, msg->wave);
+    NetWriter_U8(&w, count);
+    for (int i = 0; i < count; ++i)
+    {
+        NetWriter_U16(&w, msg->slots[i]);
+    }
+    return finish_encode(&w);
+}
+
+// --- Decoders ---
+
+bool NetCodec_DecodeHello(const void *data, int length, Msg_HelloData *out)
+{
+    NetReader r;
+    NetReader_Init(&r, data, length);
+    out->message_type = NetReader_U8(&r);
+    out->room_id = NetReader_U16(&r);
+    out->team = (NetReader_U8(&r) & FLAG_TEAM) != 0;
+    return !r.overflow;
+}
+
+bool NetCodec_DecodeWelcome(const void *data, int length, Msg_WelcomeData *out)
+{
+    NetReader r;
+    NetReader_Init(&r, data, length);
+    out->message_type = NetReader_U8(&r);
+    out->assigned_client_id = NetReader_U8(&r);
+    out->session_token = NetReader_U32(&r);
+    out->max_minions = NetReader_U16(&r);
+    out->max_attacks = NetReader_U16(&r);
+    return !r.overflow;
+}
+
+bool NetCodec_DecodeGameStart(const void *data, int length, Msg_GameStart *out)
+{
+    NetReader r;
+    NetReader_Init(&r, data, length);
+    out->message_type = NetReader_U8(&r);
+    out->server_start_time_stamp = NetReader_U64(&r);
+    return !r.overflow;
+}
+
+bool NetCodec_DecodePlayerDisconnect(const void *data, int length, Msg_PlayerDisconnectData *out)
+{
+    NetReader r;
+    NetReader_Init(&r, data, length);
+    out->message_type = NetReader_U8(&r);
+    out->client_id = NetReader_U8(&r);
+    return !r.overflow;
+}
+
+bool NetCodec_DecodeClientSpawnAttack(const void *data, int length, Msg_ClientSpawnAttackData *out)
+{
+    NetReader r;
+    NetReader_Init(&r, data, length);
+    out->message_type = NetReader_U8(&r);
+    out->attack_type = NetReader_U8(&r);
+    out->target_pos = NetReader_Position(&r);
+    out->team = (NetReader_U8(&r) & FLAG_TEAM) != 0;
+    return !r.overflow;
+}
+
+bool NetCodec_DecodeServerSpawnAttack(const void *data, int length, Msg_ServerSpawnAttackData *out)
+{
+    NetReader r;
+    NetReader_Init(&r, data, length);
+    out->message_type = NetReader_U8(&r);
+    out->attack_type = NetReader_U8(&r);
+    out->attack_id = NetReader_U32(&r);
+    out->owner_id = NetReader_U8(&r);
+    out->start_pos = NetReader_Position(&r);
+    out->target_pos = NetReader_Position(&r);
+    out->velocity.x = NetReader_F32(&r);
+    out->velocity.y = NetReader_F32(&r);
+    out->attacker = (ObjectType)NetReader_U8(&r);
+    out->team = (NetReader_U8(&r) & FLAG_TEAM) != 0;
+    return !r.overflow;
+}
+
+bool NetCodec_DecodeDestroyObject(const void *data, int length, Msg_DestroyObjectData *out)
+{
+    NetReader r;
+    NetReader_Init(&r, data, length);
+    out->message_type = NetReader_U8(&r);
+    out->object_type = NetReader_U8(&r);
+    out->object_id = NetReader_U32(&r);
+    return !r.overflow;
+}
+
+bool NetCodec_DecodeDamagePlayer(const void *data, int length, Msg_DamagePlayer *out)
+{
+    NetReader r;
+    NetReader_Init(&r, data, length);
+    out->message_type = NetReader_U8(&r);
+    out->playerIndex = NetReader_U8(&r);
+    out->damageValue = NetReader_F32(&r);
+    return !r.overflow;
+}
+
+bool NetCodec_DecodeDamageMinion(const void *data, int length, Msg_DamageMinion *out)
+{
+    NetReader r;
+    NetReader_Init(&r, data, length);
+    out->message_type = NetReader_U8(&r);
+    out->minionIndex = NetReader_U16(&r);
+    out->current_health = NetReader_F32(&r);
+    return !r.overflow;
+}
+
+bool NetCodec_DecodeDamageTower(const void *data, int length, Msg_DamageTower *out)
+{
+    NetReader r;
+    NetReader_Init(&r, data, length);
+    out->message_type = NetReader_U8(&r);
+    out->towerIndex = NetReader_U8(&r);
+    out->damageValue = NetReader_F32(&r);
+    out->current_health = NetReader_F32(&r);
+    return !r.overflow;
+}
+
+bool NetCodec_DecodeDamageBase(const void *data, int length, Msg_DamageBase *out)
+{
+    NetReader r;
+    NetReader_Init(&r, data, length);
+    out->message_type = NetReader_U8(&r);
+    out->baseIndex = NetReader_U8(&r);
+    out->damageValue = NetReader_F32(&r);
+    return !r.overflow;
+}
+
+bool NetCodec_DecodeMatchResult(const void *data, int length, Msg_MatchResult *out)
+{
+    NetReader r;
+    NetReader_Init(&r, data, length);
+    out->message_type = NetReader_U8(&r);
+    out->winningTeam = NetReader_U8(&r) != 0;
+    return !r.overflow;
+}
+
+bool NetCodec_DecodeUdpHello(const void *data, int length, Msg_UdpHelloData *out)
+{
+    NetReader r;
+    NetReader_Init(&r, data, length);
+    out->message_type = NetReader_U8(&r);
+    out->client_id = NetReader_U8(&r);
+    out->session_token = NetReader_U32(&r);
+    return !r.overflow;
+}
+
+bool NetCodec_DecodeStateAck(const void *data, int length, Msg_StateAckData *out)
+{
+    NetReader r;
+    NetReader_Init(&r, data, length);
+    out->message_type = NetReader_U8(&r);
+    out->count = NetReader_U8(&r);
+    if (out->count > MSG_STATE_ACK_MAX_ENTRIES)
+        return false;
+    for (int i = 0; i < out->count; ++i)
+    {
+        out->entries[i].client_id = NetReader_U8(&r);
+        out->entries[i].seq = NetReader_U16(&r);
+    }
+    return !r.overflow;
+}
+
+bool NetCodec_DecodePlayerInput(const void *data, int length, Msg_PlayerInputData *out)
+{
+    NetReader r;
+    NetReader_Init(&r, data, length);
+    out->message_type = NetReader_U8(&r);
+    out->newest_seq = NetReader_U16(&r);
+    out->count = NetReader_U8(&r);
+    if (out->count == 0 || out->count > MSG_PLAYER_INPUT_MAX_COMMANDS)
+        return false;
+    for (int i = 0; i < out->count; ++i)
+    {
+        out->buttons[i] = NetReader_U8(&r);
+    }
+    return !r.overflow;
+}
+
+bool NetCodec_DecodeInputAck(const void *data, int length, Msg_InputAckData *out)
+{
+    NetReader r;
+    NetReader_Init(&r, data, length);
+    out->message_type = NetReader_U8(&r);
+    out->input_seq = NetReader_U16(&r);
+    out->position = NetReader_Position(&r);
+    return !r.overflow;
+}
+
+bool NetCodec_DecodeTimePing(const void *data, int length, Msg_TimePingData *out)
+{
+    NetReader r;
+    NetReader_Init(&r, data, length);
+    out->message_type = NetReader_U8(&r);
+    out->client_time = NetReader_U64(&r);
+    return !r.overflow;
+}
+
+bool NetCodec_DecodeTimePong(const void *data, int length, Msg_TimePongData *out)
+{
+    NetReader r;
+    NetReader_Init(&r, data, length);
+    out->message_type = NetReader_U8(&r);
+    out->client_time = NetReader_U64(&r);
+    out->server_time = NetReader_U64(&r);
+    return !r.overflow;
+}
+
+bool NetCodec_DecodeMinionWave(const void *data, int length, Msg_MinionWaveData *out)
+{
+    NetReader r;
+    NetReader_Init(&r, data, length);
+    out->message_type = NetReader_U8(&r);
+    out->wave = NetReader_U16(&r);
+    out->count = NetReader_U8(&r);
+    if (out->count > MSG_MINION_WAVE_MAX_SLOTS)
+        return false;
+    for (int i = 0; i < out->count; ++i)
+    {
+        out->slots[i] = NetReader_U16(&r);
+    }
+    return !r.overflow;
+}
+
+// --- Player State Deltas ---
+
+void NetCodec_QuantizePlayerState(Msg_PlayerStateData *msg)
+{
+    msg->position.x = (float)quantize_coordinate(msg->position.x) / NET_POSITION_SCALE;
+    msg->position.y = (float)quantize_coordinate(msg->position.y) / NET_POSITION_SCALE;
+    msg->current_health = CLAMP(msg->current_health, SDL_MIN_SINT16, SDL_MAX_SINT16);
+    msg->flip_mode = (msg->flip_mode == SDL_FLIP_HORIZONTAL) ? SDL_FLIP_HORIZONTAL : SDL_FLIP_NONE;
+}
+
+Uint8 NetCodec_PlayerStateChanges(const Msg_PlayerStateData *msg, const Msg_PlayerStateData *baseline)
+{
+    Uint8 mask = 0;
+    if (msg->position.x != baseline->position.x || msg->position.y != baseline->position.y)
+        mask |= PLAYER_STATE_FIELD_POSITION;
+    if (msg->anim_row != baseline->anim_row || msg->anim_frame != baseline->anim_frame)
+        mask |= PLAYER_STATE_FIELD_ANIM;
+    if (player_state_flags(msg) != player_state_flags(baseline))
+        mask |= PLAYER_STATE_FIELD_FLAGS;
+    if (msg->current_health != baseline->current_health)
+        mask |= PLAYER_STATE_FIELD_HEALTH;
+    return mask;
+}
+
+int NetCodec_EncodePlayerStateDelta(const Msg_PlayerStateData *msg, const Msg_PlayerStateData *baseline, Uint16 seq, Uint16 baseline_seq, void *out, int out_size)
+{
+    Uint8 mask = baseline ? NetCodec_PlayerStateChanges(msg, baseline) : (PLAYER_STATE_FIELD_ALL | PLAYER_STATE_KEYFRAME);
+
+    NetWriter w;
+    NetWriter_Init(&w, out, out_size);
+    NetWriter_U8(&w, msg->message_type);
+    NetWriter_U8(&w, msg->client_id);
+    NetWriter_U16(&w, seq);
+    NetWriter_U16(&w, baseline ? baseline_seq : 0);
+    NetWriter_U16(&w, msg->timestamp);
+    NetWriter_U8(&w, mask);
+    if (mask & PLAYER_STATE_FIELD_POSITION)
+        NetWriter_Position(&w, msg->position);
+    if (mask & PLAYER_STATE_FIELD_ANIM)
+    {
+        NetWriter_U8(&w, msg->anim_row);
+        NetWriter_U8(&w, msg->anim_frame);
+    }
+    if (mask & PLAYER_STATE_FIELD_FLAGS)
+        NetWriter_U8(&w, player_state_flags(msg));
+    if (mask & PLAYER_STATE_FIELD_HEALTH)
+        NetWriter_I16(&w, (Sint16)CLAMP(msg->current_health, SDL_MIN_SINT16, SDL_MAX_SINT16));
+    return finish_encode(&w);
+}
+
+bool NetCodec_DecodePlayerStateHeader(const void *data, int length, NetPlayerStateHeader *out)
+{
+    NetReader r;
+    NetReader_Init(&r, data, length);
+    out->message_type = NetReader_U8(&r);
+    out->client_id = NetReader_U8(&r);
+    out->seq = NetReader_U16(&r);
+    out->baseline_seq = NetReader_U16(&r);
+    out->timestamp = NetReader_U16(&r);
+    out->field_mask = NetReader_U8(&r);
+    return !r.overflow;
+}
+
+bool NetCodec_DecodePlayerStateDelta(const void *data, int length, const Msg_PlayerStateData *baseline, Msg_PlayerStateData *out)
+{
+    NetPlayerStateHeader header;
+    if (!NetCodec_DecodePlayerStateHeader(data, length, &header))
+        return false;
+
+    bool keyframe = (header.field_mask & PLAYER_STATE_KEYFRAME) != 0;
+    if (!keyframe && !baseline)
+        return SDL_SetError("Player state delta %u needs missing baseline %u", header.seq, header.baseline_seq);
+
+    if (keyframe)
+        memset(out, 0, sizeof(*out));
+    else
+        *out = *baseline;
+    out->message_type = header.message_type;
+    out->client_id = header.client_id;
+    out->timestamp = header.timestamp;
+
+    NetReader r;
+    NetReader_Init(&r, data, length);
+    r.offset = PLAYER_STATE_HEADER_SIZE; // Skip the fixed header read above
+    if (header.field_mask & PLAYER_STATE_FIELD_POSITION)
+        out->position = NetReader_Position(&r);
+    if (header.field_mask & PLAYER_STATE_FIELD_ANIM)
+    {
+        out->anim_row = NetReader_U8(&r);
+        out->anim_frame = NetReader_U8(&r);
+    }
+    if (header.field_mask & PLAYER_STATE_FIELD_FLAGS)
+    {
+        Uint8 flags = NetReader_U8(&r);
+        out->flip_mode = (flags & FLAG_FLIPPED) ? SDL_FLIP_HORIZONTAL : SDL_FLIP_NONE;
+        out->team = (flags & FLAG_TEAM) != 0;
+    }
+    if (header.field_mask & PLAYER_STATE_FIELD_HEALTH)
+        out->current_health = NetReader_I16(&r);
+    return !r.overflow;
+}
@@ -0,0 +1,112 @@
+#include "../include/net_delta.h"
+
+// --- Public API Function Implementations ---
+
+bool NetDelta_SeqNewer(Uint16 a, Uint16 b)
+{
+    return (Sint16)(a - b) > 0;
+}
+
+void NetDelta_ResetSender(NetDeltaSender *tx)
+{
+    if (!tx)
+        return;
+    memset(tx, 0, sizeof(*tx));
+    tx->next_seq = 1;
+}
+
+void NetDelta_ResetReceiver(NetDeltaReceiver *rx)
+{
+    if (!rx)
+        return;
+    memset(rx, 0, sizeof(*rx));
+}
+
+int NetDelta_EncodePlayerState(NetDeltaSender *tx, const Msg_PlayerStateData *current, Uint64 now, void *out, int out_size, Uint16 *out_seq)
+{
+    if (!tx || !current || !out)
+    {
+        SDL_SetError("Invalid arguments to NetDelta_EncodePlayerState");
+        return -1;
+    }
+
+    Msg_PlayerStateData quantized = *current;
+    NetCodec_QuantizePlayerState(&quantized);
+
+    // Use the newest acknowledged state as baseline, as long as it is still in the history window
+    const Msg_PlayerStateData *baseline = NULL;
+    if (tx->has_ack && (Uint16)(tx->next_seq - tx->acked_seq) < NET_DELTA_HISTORY)
+    {
+        baseline = &tx->history[tx->acked_seq % NET_DELTA_HISTORY];
+    }
+
+    if (baseline && NetCodec_PlayerStateChanges(&quantized, baseline) == 0 &&
+        now < tx->last_send_time + PLAYER_STATE_KEEPALIVE_MS)
+    {
+        return 0; // Peer already has this exact state
+    }
+
+    Uint16 seq = tx->next_seq;
+    int length = NetCodec_EncodePlayerStateDelta(&quantized, baseline, seq, tx->acked_seq, out, out_size);
+    if (length < 0)
+    {
+        return -1;
+    }
+
+    tx->history[seq % NET_DELTA_HISTORY] = quantized;
+    tx->next_seq++;
+    tx->last_send_time = now;
+    if (out_seq)
+        *out_seq = seq;
+    return length;
+}
+
+void NetDelta_Ack(NetDeltaSender *tx, Uint16 seq)
+{
+    if (!tx)
+        return;
+    // Only move forward, and only to states we actually sent
+    if (NetDelta_SeqNewer(tx->next_seq, seq) && (!tx->has_ack || NetDelta_SeqNewer(seq, tx->acked_seq)))
+    {
+        tx->acked_seq = seq;
+        tx->has_ack = true;
+    }
+}
+
+bool NetDelta_DecodePlayerState(NetDeltaReceiver *rx, const void *data, int length, Msg_PlayerStateData *out)
+{
+    if (!rx || !data || !out)
+        return false;
+
+    NetPlayerStateHeader header;
+    if (!NetCodec_DecodePlayerStateHeader(data, length, &header))
+        return false;
+
+    if (rx->has_latest && !NetDelta_SeqNewer(header.seq, rx->latest_seq))
+    {
+        return false; // Stale or duplicate
+    }
+
+    const Msg_PlayerStateData *baseline = NULL;
+    if (!(header.field_mask & PLAYER_STATE_KEYFRAME))
+    {
+        int slot = header.baseline_seq % NET_DELTA_HISTORY;
+        if (!rx->valid[slot] || rx->seqs[slot] != header.baseline_seq)
+        {
+            SDL_SetError("Unknown baseline %u for player state %u", header.baseline_seq, header.seq);
+            return false;
+        }
+        baseline = &rx->history[slot];
+    }
+
+    if (!NetCodec_DecodePlayerStateDelta(data, length, baseline, out))
+        return false;
+
+    int slot = header.seq % NET_DELTA_HISTORY;
+    rx->history[slot] = *out;
+    rx->seqs[slot] = header.seq;
+    rx->valid[slot] = true;
+    rx->latest_seq = header.seq;
+    rx->has_latest = true;
+    return true;
+}
@@ -0,0 +1,158 @@
+#include "../include/net_frame.h"
+
+#define NET_RECV_BUFFER_MASK (NET_RECV_BUFFER_SIZE - 1)
+
+// --- Static Helper Functions ---
+
+/**
+ * @brief Copies bytes out of the ring buffer without consuming them.
+ * @param rb The receive buffer.
+ * @param offset Offset from the current head.
+ * @param dst Destination buffer.
+ * @param length Number of bytes to copy. Must not exceed rb->count - offset.
+ */
+static void ring_peek(const NetRecvBuffer *rb, int offset, Uint8 *dst, int length)
+{
+    int start = (rb->head + offset) & NET_RECV_BUFFER_MASK;
+    int first = SDL_min(length, NET_RECV_BUFFER_SIZE - start);
+    memcpy(dst, &rb->data[start], first);
+    if (first < length)
+    {
+        memcpy(dst + first, &rb->data[0], length - first);
+    }
+}
+
+/**
+ * @brief Marks bytes at the front of the ring buffer as consumed.
+ * @param rb The receive buffer.
+ * @param length Number of bytes to drop.
+ */
+static void ring_consume(NetRecvBuffer *rb, int length)
+{
+    rb->head = (rb->head + length) & NET_RECV_BUFFER_MASK;
+    rb->count -= length;
+    if (rb->count == 0)
+    {
+        rb->head = 0; // Keep reads contiguous when the buffer drains completely
+    }
+}
+
+// --- Public API Function Implementations ---
+
+void NetFrame_ResetRecvBuffer(NetRecvBuffer *rb)
+{
+    if (!rb)
+        return;
+    rb->head = 0;
+    rb->count = 0;
+}
+
+void NetFrame_ResetSendQueue(NetSendQueue *queue)
+{
+    if (!queue)
+        return;
+    queue->length = 0;
+}
+
+int NetFrame_ReadFromSocket(NetRecvBuffer *rb, SDLNet_StreamSocket *socket)
+{
+    if (!rb || !socket)
+    {
+        return -1;
+    }
+
+    int total = 0;
+    while (rb->count < NET_RECV_BUFFER_SIZE)
+    {
+        // Read into the largest contiguous free region after the tail
+        int tail = (rb->head + rb->count) & NET_RECV_BUFFER_MASK;
+        int contiguous_free = (tail >= rb->head || rb->count == 0) ? NET_RECV_BUFFER_SIZE - tail : rb->head - tail;
+        contiguous_free = SDL_min(contiguous_free, NET_RECV_BUFFER_SIZE - rb->count);
+
+        int bytes_read = SDLNet_ReadFromStreamSocket(socket, &rb->data[tail], contiguous_free);
+        if (bytes_read < 0)
+        {
+            // Hand back what was already read; the error resurfaces on the next call
+            return total > 0 ? total : -1;
+        }
+        rb->count += bytes_read;
+        total += bytes_read;
+
+        if (bytes_read < contiguous_free)
+        {
+            break; // Socket drained for now
+        }
+    }
+    return total;
+}
+
+int NetFrame_PopFrame(NetRecvBuffer *rb, void *out_payload, int out_size)
+{
+    if (!rb || !out_payload || rb->count < NET_FRAME_HEADER_SIZE)
+    {
+        return 0;
+    }
+
+    Uint8 header[NET_FRAME_HEADER_SIZE];
+    ring_peek(rb, 0, header, NET_FRAME_HEADER_SIZE);
+    int length = (int)header[0] | ((int)header[1] << 8);
+
+    if (length <= 0 || length > NET_FRAME_MAX_PAYLOAD)
+    {
+        SDL_SetError("Invalid frame length %d", length);
+        return -1;
+    }
+    if (length > out_size)
+    {
+        SDL_SetError("Frame of %d bytes does not fit output buffer of %d bytes", length, out_size);
+        return -1;
+    }
+    if (rb->count < NET_FRAME_HEADER_SIZE + length)
+    {
+        return 0; // Frame not fully received yet
+    }
+
+    ring_peek(rb, NET_FRAME_HEADER_SIZE, (Uint8 *)out_payload, length);
+    ring_consume(rb, NET_FRAME_HEADER_SIZE + length);
+    return length;
+}
+
+bool NetFrame_QueueFrame(NetSendQueue *queue, SDLNet_StreamSocket *socket, const void *payload, int length)
+{
+    if (!queue || !payload || length <= 0 || length > NET_FRAME_MAX_PAYLOAD)
+    {
+        return SDL_SetError("Invalid frame (length %d)", length);
+    }
+
+    if (queue->length + NET_FRAME_HEADER_SIZE + length > NET_SEND_QUEUE_SIZE)
+    {
+        // Batch is full; push what we have so far and start a new one
+        if (!NetFrame_FlushSendQueue(queue, socket))
+        {
+            return false;
+        }
+    }
+
+    Uint8 *dst = &queue->data[queue->length];
+    dst[0] = (Uint8)(length & 0xFF);
+    dst[1] = (Uint8)((length >> 8) & 0xFF);
+    memcpy(&dst[NET_FRAME_HEADER_SIZE], payload, length);
+    queue->length += NET_FRAME_HEADER_SIZE + length;
+    return true;
+}
+
+bool NetFrame_FlushSendQueue(NetSendQueue *queue, SDLNet_StreamSocket *socket)
+{
+    if (!queue || queue->length == 0)
+    {
+        return true;
+    }
+    if (!socket)
+    {
+        return SDL_SetError("Cannot flush send queue without a socket");
+    }
+
+    int length = queue->length;
+    queue->length = 0; // Drop the batch either way; a failed write means the connection is gone
+    return SDLNet_WriteToStreamSocket(socket, queue->data, length);
+}
@@ -12,6 +12,17 @@ typedef enum ServerClientStatus
     CLIENT_STATE_WELCOMED  /**< C_HELLO received, S_WELCOME sent, client is fully active. */
 } ServerClientStatus;
 
+#define SERVER_INPUT_QUEUE_MAX 64 /**< Received input commands a client may have waiting for budget (about a second of ticks). */
+
+/**
+ * @brief An input command received but not applied yet.
+ */
+typedef struct QueuedInput
+{
+    Uint16 seq;    /**< Sequence number of the command. */
+    Uint8 buttons; /**< PLAYER_INPUT_* bits of the command. */
+} QueuedInput;
+
 /**
  * @brief Holds information about a connected client on the server.
  */
@@ -20,6 +31,28 @@ typedef struct ServerClientInfo
     SDLNet_StreamSocket *socket; /**< The communication socket for this client. */
     ServerClientStatus status;   /**< The current status of this client connection. */
     uint8_t client_id;           /**< The unique ID assigned to this client. */
+    NetRecvBuffer recv_buffer;   /**< Accumulates stream bytes until complete frames are available. */
+    NetSendQueue send_queue;     /**< Frames produced this tick, written in one call at the end of the update pass. */
+    NetDeltaReceiver state_rx;   /**< Player states received from this client. */
+    NetDeltaSender *state_tx;    /**< Every other player's state as sent to this client, indexed by source client (max_clients entries). */
+    uint32_t session_token;      /**< Secret sent in S_WELCOME; a C_UDP_HELLO must echo it to bind a datagram endpoint. */
+    SDLNet_Address *udp_address; /**< Datagram endpoint of this client once bound, or NULL. */
+    Uint16 udp_port;             /**< Port of the bound datagram endpoint. */
+    bool state_ack_pending;      /**< A player state arrived over UDP and has not been acknowledged yet. */
+    SDL_FPoint player_position;  /**< Authoritative position of this client's player, simulated from its inputs. */
+    bool team;                   /**< Team named in C_HELLO; the player spawns for it and its relayed states carry it. */
+    bool player_spawned;         /**< Set once an input with PLAYER_INPUT_SPAWN placed the player; earlier inputs are skipped. */
+    bool spawn_allowed;          /**< The next PLAYER_INPUT_SPAWN may place the player: it has not spawned yet, or the server saw it die since. */
+    Uint16 last_input_seq;       /**< Newest input command applied. */
+    Uint16 last_queued_seq;      /**< Newest input command received, applied or still queued. */
+    bool has_input;              /**< False until an input command has been received. */
+    int input_budget;            /**< Input commands the client may still apply; refilled by one per tick. */
+    QueuedInput input_queue[SERVER_INPUT_QUEUE_MAX]; /**< Commands waiting for budget, oldest at input_queue_head. */
+    int input_queue_head;        /**< Index in input_queue of the oldest waiting command. */
+    int input_queue_count;       /**< Entries in input_queue. */
+    bool input_ack_pending;      /**< Inputs were applied this tick and S_INPUT_ACK has not been sent yet. */
+    Msg_PlayerStateData relayed_state; /**< Newest state of this client's player, as relayed to the others. */
+    bool has_relayed_state;      /**< False until a state of this client's player has been relayed. */
 } ServerClientInfo;
 
 /**
@@ -28,10 +61,20 @@ typedef struct ServerClientInfo
 struct NetServerState_s
 {
     SDLNet_Server *listen_socket;          /**< The main server socket listening for new connections. */
-    ServerClientInfo clients[MAX_CLIENTS]; /**< Array holding information for each potential client slot. */
+    SDLNet_DatagramSocket *udp_socket;     /**< Unreliable channel for player state, or NULL if it could not be opened. */
+    ServerClientInfo *clients;             /**< Array holding information for each client slot (max_clients entries). */
+    int max_clients;                       /**< Number of client slots, from --max-players. */
+    NetDeltaSender *state_tx_pool;         /**< Backing store of every client's state_tx row. */
     int connected_clients_count;           /**< Current number of clients in ACCEPTED or WELCOMED state. */
+    Uint16 room_id;                        /**< Room this server runs; C_HELLO must name it. */
+    bool shares_sockets;                   /**< Room server: the RoomHost owns the sockets, accepts for it and hands it its datagrams. */
 };
 
+// --- Constants ---
+#define SERVER_INPUT_BURST MSG_PLAYER_INPUT_MAX_COMMANDS /**< Input commands a client can bank, so a burst of delayed packets is not dropped. */
+#define SERVER_AOI_RADIUS 1000.0f                        /**< Players this close to a client's own player, which its camera follows, get every state. */
+#define SERVER_AOI_FAR_INTERVAL_MS 500                   /**< Players farther away are updated this often. */
+
 // --- Static Helper Functions ---
 
 /**
@@ -43,23 +86,24 @@ static int find_inactive_client_slot(NetServerState ns_state)
 {
     if (!ns_state)
         return -1;
-    for (int i = 0; i < MAX_CLIENTS; ++i)
+    for (int i = 0; i < ns_state->max_clients; ++i)
     {
         if (ns_state->clients[i].status == CLIENT_STATE_INACTIVE)
         {
             return i;
         }
     }
-    SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Server] Max clients (%d) reached.", MAX_CLIENTS);
+    SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Server] Max clients (%d) reached.", ns_state->max_clients);
     return -1; // Server full
 }
 
 /**
- * @brief Sends a data buffer to a specific client.
+ * @brief Queues a data buffer for a specific client.
+ * The message is written together with everything else queued this tick when the server flushes.
  * @param client_info Pointer to the ServerClientInfo for the target client.
  * @param buffer Pointer to the data buffer to send.
  * @param length The number of bytes to send from the buffer.
- * @return True if the send was successful, false on failure.
+ * @return True if the message was queued, false on failure.
  */
 static bool send_to_client(ServerClientInfo *client_info, const void *buffer, int length)
 {
@@ -67,7 +111,7 @@ static bool send_to_client(ServerClientInfo *client_info, const void *buffer, in
     {
         return false;
     }
-    if (!SDLNet_WriteToStreamSocket(client_info->socket, buffer, length))
+    if (!NetFrame_QueueFrame(&client_info->send_queue, client_info->socket, buffer, length))
     {
         SDL_LogError(SDL_LOG_CATEGORY_ERROR, "[Server] Send failed to client ID %u: %s.", (unsigned int)client_info->client_id, SDL_GetError());
         return false;
@@ -75,6 +119,82 @@ static bool send_to_client(ServerClientInfo *client_info, const void *buffer, in
     return true;
 }
 
+/**
+ * @brief Sends a single datagram to a client's bound endpoint.
+ * Datagrams are not batched; each one is a complete message.
+ * @param ns_state The NetServerState instance.
+ * @param client_info Pointer to the ServerClientInfo for the target client.
+ * @param buffer Pointer to the data buffer to send.
+ * @param length The number of bytes to send from the buffer.
+ * @return True if the datagram was handed to the OS, false on failure.
+ */
+static bool send_datagram_to_client(NetServerState ns_state, ServerClientInfo *client_info, const void *buffer, int length)
+{
+    if (!ns_state->udp_socket || !client_info->udp_address)
+    {
+        return false;
+    }
+    if (!SDLNet_SendDatagram(ns_state->udp_socket, client_info->udp_address, client_info->udp_port, buffer, length))
+    {
+        SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Server] Datagram send failed to client ID %u: %s.", (unsigned int)client_info->client_id, SDL_GetError());
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Forgets a client's datagram endpoint so player state falls back to the stream.
+ * @param client_info Pointer to the ServerClientInfo to unbind.
+ */
+static void unbind_udp_endpoint(ServerClientInfo *client_info)
+{
+    if (client_info->udp_address)
+    {
+        SDLNet_UnrefAddress(client_info->udp_address);
+        client_info->udp_address = NULL;
+    }
+    client_info->udp_port = 0;
+    client_info->state_ack_pending = false;
+}
+
+/**
+ * @brief Finds the welcomed client whose bound datagram endpoint matches a sender.
+ * @param ns_state The NetServerState instance.
+ * @param address Source address of a received datagram.
+ * @param port Source port of a received datagram.
+ * @return The client index, or -1 if no client has bound that endpoint.
+ */
+static int find_client_by_udp_endpoint(NetServerState ns_state, SDLNet_Address *address, Uint16 port)
+{
+    for (int i = 0; i < ns_state->max_clients; ++i)
+    {
+        ServerClientInfo *client_info = &ns_state->clients[i];
+        if (client_info->status == CLIENT_STATE_WELCOMED && client_info->udp_address &&
+            client_info->udp_port == port && SDLNet_CompareAddresses(client_info->udp_address, address) == 0)
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Resets every player-state link that involves the given client slot.
+ * Called when the slot changes owner so the new player starts from keyframes in both directions.
+ * @param ns_state The NetServerState instance.
+ * @param client_index The client slot being (re)assigned.
+ */
+static void reset_state_links(NetServerState ns_state, int client_index)
+{
+    ServerClientInfo *client_info = &ns_state->clients[client_index];
+    NetDelta_ResetReceiver(&client_info->state_rx);
+    for (int i = 0; i < ns_state->max_clients; ++i)
+    {
+        NetDelta_ResetSender(&client_info->state_tx[i]);
+        NetDelta_ResetSender(&ns_state->clients[i].state_tx[client_index]);
+    }
+}
+
 /**
  * @brief Internal implementation for broadcasting messages to all relevant clients.
  * Sends the provided buffer to all clients in the WELCOMED state, optionally excluding one.
@@ -93,7 +213,7 @@ static void internal_broadcast_message_impl(NetServerState ns_state, const void
  */
 static void disconnect_client(NetServerState ns_state, int client_index)
 {
-    if (!ns_state || client_index < 0 || client_index >= MAX_CLIENTS || ns_state->clients[client_index].status == CLIENT_STATE_INACTIVE)
+    if (!ns_state || client_index < 0 || client_index >= ns_state->max_clients || ns_state->clients[client_index].status == CLIENT_STATE_INACTIVE)
     {
         return;
     }
@@ -114,6 +234,9 @@ static void disconnect_client(NetServerState ns_state, int client_index)
         SDLNet_DestroyStreamSocket(client_info->socket);
         client_info->socket = NULL;
     }
+    NetFrame_ResetSendQueue(&client_info->send_queue);
+    unbind_udp_endpoint(client_info);
+    reset_state_links(ns_state, client_index);
 
     // Only notify others if the client was fully connected (WELCOMED)
     if (old_status == CLIENT_STATE_WELCOMED)
@@ -121,7 +244,12 @@ static void disconnect_client(NetServerState ns_state, int client_index)
         Msg_PlayerDisconnectData disconnect_msg;
         disconnect_msg.message_type = MSG_TYPE_S_PLAYER_DISCONNECT;
         disconnect_msg.client_id = disconnected_id;
-        internal_broadcast_message_impl(ns_state, &disconnect_msg, sizeof(disconnect_msg), client_index); // Use internal impl to avoid infinite loop
+        Uint8 encoded[NET_CODEC_MAX_MESSAGE_SIZE];
+        int encoded_length = NetCodec_EncodePlayerDisconnect(&disconnect_msg, encoded, sizeof(encoded));
+        if (encoded_length > 0)
+        {
+            internal_broadcast_message_impl(ns_state, encoded, encoded_length, client_index); // Use internal impl to avoid infinite loop
+        }
     }
 }
 
@@ -131,7 +259,7 @@ static void internal_broadcast_message_impl(NetServerState ns_state, const void
         return;
     bool disconnect_flags[MAX_CLIENTS] = {false}; // Track clients failing to receive
 
-    for (int i = 0; i < MAX_CLIENTS; ++i)
+    for (int i = 0; i < ns_state->max_clients; ++i)
     {
         if (i == exclude_client_index || ns_state->clients[i].status != CLIENT_STATE_WELCOMED)
         {
@@ -144,7 +272,7 @@ static void internal_broadcast_message_impl(NetServerState ns_state, const void
         }
     }
     // Disconnect clients that failed the broadcast after attempting all sends
-    for (int i = 0; i < MAX_CLIENTS; ++i)
+    for (int i = 0; i < ns_state->max_clients; ++i)
     {
         if (disconnect_flags[i])
         {
@@ -157,9 +285,256 @@ static void internal_broadcast_message_impl(NetServerState ns_state, const void
     }
 }
 
+/**
+ * @brief Tells whether a position is within a client's area of interest.
+ * The camera follows the client's player, so the area is a circle around it. Until the
+ * player has spawned its view is unknown and everything counts as near.
+ * @param viewer The client receiving updates.
+ * @param position World position of the entity.
+ * @return True if the entity deserves full-rate updates.
+ */
+static bool in_area_of_interest(const ServerClientInfo *viewer, SDL_FPoint position)
+{
+    if (!viewer->player_spawned)
+        return true;
+
+    float dx = position.x - viewer->player_position.x;
+    float dy = position.y - viewer->player_position.y;
+    return dx * dx + dy * dy <= SERVER_AOI_RADIUS * SERVER_AOI_RADIUS;
+}
+
+/**
+ * @brief Sends one player's newest state to one client.
+ * The client gets a delta against the last state it acknowledged for that player, so a player
+ * whose state has not changed costs nothing. Clients with a bound datagram endpoint get it over
+ * UDP and acknowledge it with C_STATE_ACK; the rest get it on the stream.
+ * @param ns_state The NetServerState instance.
+ * @param client_info The destination client.
+ * @param source_index Index of the client the state belongs to.
+ * @param now Current tick in ms.
+ * @return False if queueing on the stream failed.
+ */
+static bool send_player_state(NetServerState ns_state, ServerClientInfo *client_info, int source_index, Uint64 now)
+{
+    NetDeltaSender *tx = &client_info->state_tx[source_index];
+    Uint8 encoded[NET_CODEC_MAX_MESSAGE_SIZE];
+    Uint16 seq;
+    int encoded_length = NetDelta_EncodePlayerState(tx, &ns_state->clients[source_index].relayed_state, now, encoded, sizeof(encoded), &seq);
+    if (encoded_length <= 0)
+    {
+        return true; // Nothing new for this client
+    }
+    if (client_info->udp_address)
+    {
+        send_datagram_to_client(ns_state, client_info, encoded, encoded_length); // Lost datagrams are simply superseded
+        return true;
+    }
+    if (!send_to_client(client_info, encoded, encoded_length))
+    {
+        return false;
+    }
+    NetDelta_Ack(tx, seq); // The stream is reliable, so a queued state is a delivered state
+    return true;
+}
+
+/**
+ * @brief Relays one player's state to the welcomed clients it is near.
+ * Clients farther away get it from relay_distant_player_states at a lower rate.
+ * @param ns_state The NetServerState instance.
+ * @param source_index Index of the client the state belongs to.
+ * @param player_state The full state to relay (message_type set to MSG_TYPE_S_PLAYER_STATE).
+ */
+static void relay_player_state(NetServerState ns_state, int source_index, const Msg_PlayerStateData *player_state)
+{
+    bool disconnect_flags[MAX_CLIENTS] = {false};
+    Uint64 now = SDL_GetTicks();
+
+    ns_state->clients[source_index].relayed_state = *player_state;
+    ns_state->clients[source_index].has_relayed_state = true;
+
+    for (int i = 0; i < ns_state->max_clients; ++i)
+    {
+        ServerClientInfo *client_info = &ns_state->clients[i];
+        if (i == source_index || client_info->status != CLIENT_STATE_WELCOMED || !in_area_of_interest(client_info, player_state->position))
+        {
+            continue;
+        }
+        disconnect_flags[i] = !send_player_state(ns_state, client_info, source_index, now);
+    }
+
+    for (int i = 0; i < ns_state->max_clients; ++i)
+    {
+        if (disconnect_flags[i] && ns_state->clients[i].status != CLIENT_STATE_INACTIVE)
+        {
+            disconnect_client(ns_state, i);
+        }
+    }
+}
+
+/**
+ * @brief Sends the players outside each client's area of interest at SERVER_AOI_FAR_INTERVAL_MS.
+ * Runs every tick, so the last state of a player that stopped far away still arrives without
+ * waiting for its next keepalive, and per-client traffic depends on who is nearby rather than
+ * on how many players there are.
+ * @param ns_state The NetServerState instance.
+ */
+static void relay_distant_player_states(NetServerState ns_state)
+{
+    bool disconnect_flags[MAX_CLIENTS] = {false};
+    Uint64 now = SDL_GetTicks();
+
+    for (int i = 0; i < ns_state->max_clients; ++i)
+    {
+        ServerClientInfo *client_info = &ns_state->clients[i];
+        if (client_info->status != CLIENT_STATE_WELCOMED)
+            continue;
+
+        for (int source = 0; source < ns_state->max_clients && !disconnect_flags[i]; ++source)
+        {
+            const ServerClientInfo *source_info = &ns_state->clients[source];
+            if (source == i || source_info->status != CLIENT_STATE_WELCOMED || !source_info->has_relayed_state ||
+                in_area_of_interest(client_info, source_info->relayed_state.position) ||
+                now < client_info->state_tx[source].last_send_time + SERVER_AOI_FAR_INTERVAL_MS)
+            {
+                continue;
+            }
+            disconnect_flags[i] = !send_player_state(ns_state, client_info, source, now);
+        }
+    }
+
+    for (int i = 0; i < ns_state->max_clients; ++i)
+    {
+        if (disconnect_flags[i] && ns_state->clients[i].status != CLIENT_STATE_INACTIVE)
+        {
+            disconnect_client(ns_state, i);
+        }
+    }
+}
+
+/**
+ * @brief Simulates queued input commands, in order, while the client has budget left.
+ * Each command moves the player by exactly one tick, as it did on the client; the budget keeps a
+ * client from moving faster by sending more inputs than it has ticks. PLAYER_INPUT_SPAWN only
+ * teleports the player when spawn_allowed, so a client cannot jump home at will.
+ * @param client_info The client whose commands to apply.
+ * @param state Pointer to the main AppState.
+ */
+static void apply_queued_inputs(ServerClientInfo *client_info, AppState *state)
+{
+    while (client_info->input_queue_count > 0 && client_info->input_budget > 0)
+    {
+        const QueuedInput *command = &client_info->input_queue[client_info->input_queue_head];
+        client_info->input_queue_head = (client_info->input_queue_head + 1) % SERVER_INPUT_QUEUE_MAX;
+        client_info->input_queue_count--;
+        client_info->input_budget--;
+        client_info->last_input_seq = command->seq;
+
+        Uint8 buttons = command->buttons;
+        if ((buttons & PLAYER_INPUT_SPAWN) && client_info->spawn_allowed)
+        {
+            client_info->spawn_allowed = false;
+            client_info->player_spawned = true;
+        }
+        else
+        {
+            buttons &= (Uint8)~PLAYER_INPUT_SPAWN;
+        }
+        if (client_info->player_spawned)
+        {
+            Player_ApplyInput(state, &client_info->player_position, client_info->team, buttons, state->delta_time);
+            client_info->input_ack_pending = true;
+        }
+    }
+}
+
+/**
+ * @brief Queues the commands of a C_PLAYER_INPUT that have not been received yet, then applies what the budget allows.
+ * Commands beyond the budget wait in the queue for later ticks rather than for a later copy, since on
+ * the stream every command is sent only once.
+ * @param client_info The client the inputs came from.
+ * @param input The decoded message.
+ * @param state Pointer to the main AppState.
+ */
+static void apply_player_input(ServerClientInfo *client_info, const Msg_PlayerInputData *input, AppState *state)
+{
+    for (int i = 0; i < input->count; ++i)
+    {
+        Uint16 seq = (Uint16)(input->newest_seq - (input->count - 1 - i));
+        if (client_info->has_input && !NetDelta_SeqNewer(seq, client_info->last_queued_seq))
+            continue; // Already received in an earlier copy
+        if (client_info->input_queue_count == SERVER_INPUT_QUEUE_MAX)
+        {
+            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Server] Input queue of client %u is full, dropping input %u.", (unsigned int)client_info->client_id, (unsigned int)seq);
+            break;
+        }
+
+        QueuedInput *command = &client_info->input_queue[(client_info->input_queue_head + client_info->input_queue_count) % SERVER_INPUT_QUEUE_MAX];
+        command->seq = seq;
+        command->buttons = input->buttons[i];
+        client_info->input_queue_count++;
+        client_info->last_queued_seq = seq;
+        client_info->has_input = true;
+    }
+
+    apply_queued_inputs(client_info, state);
+}
+
+/**
+ * @brief Tells a client which of its inputs were applied and where they left its player.
+ * Goes over UDP when the client has a bound endpoint (a lost ack is superseded by the next), else on the stream.
+ * @param ns_state The NetServerState instance.
+ * @param client_info The client to answer.
+ * @return False if queueing on the stream failed.
+ */
+static bool send_input_ack(NetServerState ns_state, ServerClientInfo *client_info)
+{
+    client_info->input_ack_pending = false;
+
+    Msg_InputAckData ack;
+    ack.message_type = MSG_TYPE_S_INPUT_ACK;
+    ack.input_seq = client_info->last_input_seq;
+    ack.position = client_info->player_position;
+    Uint8 encoded[NET_CODEC_MAX_MESSAGE_SIZE];
+    int encoded_length = NetCodec_EncodeInputAck(&ack, encoded, sizeof(encoded));
+    if (encoded_length <= 0)
+        return true;
+    if (client_info->udp_address)
+    {
+        send_datagram_to_client(ns_state, client_info, encoded, encoded_length);
+        return true;
+    }
+    return send_to_client(client_info, encoded, encoded_length);
+}
+
+/**
+ * @brief Answers a C_TIME_PING with the server's clock.
+ * Goes over UDP when the client has a bound endpoint, else on the stream.
+ * @param ns_state The NetServerState instance.
+ * @param client_info The client to answer.
+ * @param ping The received ping.
+ * @return False if queueing on the stream failed.
+ */
+static bool send_time_pong(NetServerState ns_state, ServerClientInfo *client_info, const Msg_TimePingData *ping)
+{
+    Msg_TimePongData pong;
+    pong.message_type = MSG_TYPE_S_TIME_PONG;
+    pong.client_time = ping->client_time;
+    pong.server_time = SDL_GetTicks();
+    Uint8 encoded[NET_CODEC_MAX_MESSAGE_SIZE];
+    int encoded_length = NetCodec_EncodeTimePong(&pong, encoded, sizeof(encoded));
+    if (encoded_length <= 0)
+        return true;
+    if (client_info->udp_address)
+    {
+        send_datagram_to_client(ns_state, client_info, encoded, encoded_length);
+        return true;
+    }
+    return send_to_client(client_info, encoded, encoded_length);
+}
+
 /**
  * @brief Processes a message received from a specific client based on its type.
- * Handles C_HELLO, C_PLAYER_STATE, and C_SPAWN_ATTACK messages.
+ * Handles messages from both the stream and the datagram channel.
  * @param ns_state The NetServerState instance.
  * @param client_index The index of the sending client.
  * @param buffer Pointer to the received data buffer.
@@ -168,7 +543,7 @@ static void internal_broadcast_message_impl(NetServerState ns_state, const void
  */
 static void internal_process_client_message(NetServerState ns_state, int client_index, char *buffer, int bytesReceived, AppState *state)
 {
-    if (!ns_state || client_index < 0 || client_index >= MAX_CLIENTS || ns_state->clients[client_index].status == CLIENT_STATE_INACTIVE || bytesReceived < (int)sizeof(uint8_t) || !state)
+    if (!ns_state || client_index < 0 || client_index >= ns_state->max_clients || ns_state->clients[client_index].status == CLIENT_STATE_INACTIVE || bytesReceived < (int)sizeof(uint8_t) || !state)
     {
         return;
     }
@@ -176,6 +551,8 @@ static void internal_process_client_message(NetServerState ns_state, int client_
     ServerClientInfo *client_info = &ns_state->clients[client_index];
     uint8_t msg_type_byte = (uint8_t)buffer[0];
     uint8_t sender_id = client_info->client_id;
+    Uint8 encoded[NET_CODEC_MAX_MESSAGE_SIZE]; // Scratch space for re-encoding relayed messages
+    int encoded_length;
 
     SDL_LogDebug(SDL_LOG_CATEGORY_APPLICATION, "[Server] Processing msg type %u from client %u (status: %d)", (unsigned int)msg_type_byte, (unsigned int)sender_id, client_info->status);
 
@@ -187,12 +564,25 @@ static void internal_process_client_message(NetServerState ns_state, int client_
             SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Server] Received C_HELLO from client ID %u in unexpected state (%d). Ignoring.", (unsigned int)sender_id, client_info->status);
             break;
         }
+        Msg_HelloData hello;
+        if (!NetCodec_DecodeHello(buffer, bytesReceived, &hello) || hello.room_id != ns_state->room_id)
+        {
+            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Server] C_HELLO from client ID %u does not name room %u. Disconnecting.", (unsigned int)sender_id, (unsigned int)ns_state->room_id);
+            disconnect_client(ns_state, client_index);
+            break;
+        }
         SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[Server] Received C_HELLO from client ID %u. Sending S_WELCOME.", (unsigned int)sender_id);
+        client_info->team = hello.team;
         Msg_WelcomeData welcome_msg;
         welcome_msg.message_type = MSG_TYPE_S_WELCOME;
         welcome_msg.assigned_client_id = sender_id;
+        welcome_msg.session_token = SDL_rand_bits();
+        welcome_msg.max_minions = (uint16_t)state->max_minions;
+        welcome_msg.max_attacks = (uint16_t)state->max_attacks;
+        client_info->session_token = welcome_msg.session_token;
+        encoded_length = NetCodec_EncodeWelcome(&welcome_msg, encoded, sizeof(encoded));
 
-        if (send_to_client(client_info, &welcome_msg, sizeof(welcome_msg)))
+        if (encoded_length > 0 && send_to_client(client_info, encoded, encoded_length))
         {
             SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[Server] S_WELCOME sent successfully to client ID %u. Setting state to WELCOMED.", (unsigned int)sender_id);
             client_info->status = CLIENT_STATE_WELCOMED;
@@ -210,22 +600,88 @@ static void internal_process_client_message(NetServerState ns_state, int client_
             SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Server] Received C_PLAYER_STATE from client ID %u not in WELCOMED state (%d). Ignoring.", (unsigned int)sender_id, client_info->status);
             break;
         }
-        if (bytesReceived >= (int)sizeof(Msg_PlayerStateData))
+        Msg_PlayerStateData state_data;
+        if (NetDelta_DecodePlayerState(&client_info->state_rx, buffer, bytesReceived, &state_data))
         {
-            Msg_PlayerStateData state_data;
-            memcpy(&state_data, buffer, sizeof(Msg_PlayerStateData));
-
             if (state_data.client_id != sender_id)
             {
                 SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Server] Received PLAYER_STATE from client %u claiming to be %u. Ignoring.", (unsigned int)sender_id, (unsigned int)state_data.client_id);
                 break;
             }
+            client_info->state_ack_pending = client_info->udp_address != NULL;
+            if (client_info->player_spawned)
+            {
+                state_data.position = client_info->player_position; // Movement is simulated here, not taken from the client
+            }
+            state_data.team = client_info->team;
+            if (state_data.current_health <= 0)
+            {
+                client_info->spawn_allowed = true; // The owner reported its death, so its next spawn is a respawn
+            }
             state_data.message_type = MSG_TYPE_S_PLAYER_STATE; // Change type for broadcast
-            NetServer_BroadcastMessage(ns_state, &state_data, sizeof(Msg_PlayerStateData), client_index);
+            relay_player_state(ns_state, client_index, &state_data);
+            if (state->is_dedicated)
+            {
+                PlayerManager_UpdateRemotePlayer(state, &state_data);
+            }
+        }
+        else
+        {
+            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Server] Dropped C_PLAYER_STATE msg from client %u (%d bytes): %s", (unsigned int)sender_id, bytesReceived, SDL_GetError());
+        }
+        break;
+
+    case MSG_TYPE_C_STATE_ACK:
+        if (client_info->status != CLIENT_STATE_WELCOMED)
+        {
+            break;
+        }
+        Msg_StateAckData state_ack;
+        if (NetCodec_DecodeStateAck(buffer, bytesReceived, &state_ack))
+        {
+            for (int i = 0; i < state_ack.count; ++i)
+            {
+                if (state_ack.entries[i].client_id < ns_state->max_clients)
+                {
+                    NetDelta_Ack(&client_info->state_tx[state_ack.entries[i].client_id], state_ack.entries[i].seq);
+                }
+            }
+        }
+        else
+        {
+            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Server] Rcvd malformed C_STATE_ACK msg from client %u (%d bytes)", (unsigned int)sender_id, bytesReceived);
+        }
+        break;
+
+    case MSG_TYPE_C_PLAYER_INPUT:
+        if (client_info->status != CLIENT_STATE_WELCOMED)
+        {
+            break;
+        }
+        Msg_PlayerInputData player_input;
+        if (NetCodec_DecodePlayerInput(buffer, bytesReceived, &player_input))
+        {
+            apply_player_input(client_info, &player_input, state);
+        }
+        else
+        {
+            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Server] Rcvd malformed C_PLAYER_INPUT msg from client %u (%d bytes)", (unsigned int)sender_id, bytesReceived);
+        }
+        break;
+
+    case MSG_TYPE_C_TIME_PING:
+        if (client_info->status != CLIENT_STATE_WELCOMED)
+        {
+            break;
+        }
+        Msg_TimePingData time_ping;
+        if (NetCodec_DecodeTimePing(buffer, bytesReceived, &time_ping))
+        {
+            send_time_pong(ns_state, client_info, &time_ping);
         }
         else
         {
-            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Server] Rcvd incomplete C_PLAYER_STATE msg from client %u (%d bytes, needed %lu)", (unsigned int)sender_id, bytesReceived, (unsigned long)sizeof(Msg_PlayerStateData));
+            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Server] Rcvd malformed C_TIME_PING msg from client %u (%d bytes)", (unsigned int)sender_id, bytesReceived);
         }
         break;
 
@@ -235,11 +691,9 @@ static void internal_process_client_message(NetServerState ns_state, int client_
             SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Server] Received C_SPAWN_ATTACK from client ID %u not in WELCOMED state (%d). Ignoring.", (unsigned int)sender_id, client_info->status);
             break;
         }
-        if (bytesReceived >= (int)sizeof(Msg_ClientSpawnAttackData))
+        Msg_ClientSpawnAttackData req_data;
+        if (NetCodec_DecodeClientSpawnAttack(buffer, bytesReceived, &req_data))
         {
-            Msg_ClientSpawnAttackData req_data;
-            memcpy(&req_data, buffer, sizeof(Msg_ClientSpawnAttackData));
-
             if (state->attack_manager)
             {
                 AttackManager_HandleClientSpawnRequest(state->attack_manager, state, sender_id, req_data);
@@ -251,7 +705,7 @@ static void internal_process_client_message(NetServerState ns_state, int client_
         }
         else
         {
-            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Server] Rcvd incomplete C_SPAWN_ATTACK msg from client %u (%d bytes, needed %lu)", (unsigned int)sender_id, bytesReceived, (unsigned long)sizeof(Msg_ClientSpawnAttackData));
+            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Server] Rcvd truncated C_SPAWN_ATTACK msg from client %u (%d bytes)", (unsigned int)sender_id, bytesReceived);
         }
         break;
 
@@ -261,17 +715,23 @@ static void internal_process_client_message(NetServerState ns_state, int client_
             SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Server] Received C_DAMAGE_PLAYER from client ID %u not in WELCOMED state (%d). Ignoring.", (unsigned int)sender_id, client_info->status);
             break;
         }
-        if (bytesReceived >= (int)sizeof(Msg_DamagePlayer))
+        Msg_DamagePlayer damage_player;
+        if (NetCodec_DecodeDamagePlayer(buffer, bytesReceived, &damage_player))
         {
-            Msg_DamagePlayer state_data;
-            memcpy(&state_data, buffer, sizeof(Msg_DamagePlayer));
-
-            state_data.message_type = MSG_TYPE_S_DAMAGE_PLAYER; // Change type for broadcast
-            NetServer_BroadcastMessage(ns_state, &state_data, sizeof(Msg_DamagePlayer), client_index);
+            if (state->is_dedicated && damage_player.playerIndex >= 0 && damage_player.playerIndex < MAX_CLIENTS)
+            {
+                damagePlayer(*state, damage_player.playerIndex, damage_player.damageValue, false);
+            }
+            damage_player.message_type = MSG_TYPE_S_DAMAGE_PLAYER; // Change type for broadcast
+            encoded_length = NetCodec_EncodeDamagePlayer(&damage_player, encoded, sizeof(encoded));
+            if (encoded_length > 0)
+            {
+                NetServer_BroadcastMessage(ns_state, encoded, encoded_length, client_index);
+            }
         }
         else
         {
-            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Server] Rcvd incomplete C_DAMAGE_PLAYER msg from client %u (%d bytes, needed %lu)", (unsigned int)sender_id, bytesReceived, (unsigned long)sizeof(Msg_DamagePlayer));
+            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Server] Rcvd truncated C_DAMAGE_PLAYER msg from client %u (%d bytes)", (unsigned int)sender_id, bytesReceived);
         }
         break;
 
@@ -281,17 +741,24 @@ static void internal_process_client_message(NetServerState ns_state, int client_
             SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Server] Received C_DAMAGE_MINION from client ID %u not in WELCOMED state (%d). Ignoring.", (unsigned int)sender_id, client_info->status);
             break;
         }
-        if (bytesReceived >= (int)sizeof(Msg_DamageMinion))
+        Msg_DamageMinion damage_minion;
+        if (NetCodec_DecodeDamageMinion(buffer, bytesReceived, &damage_minion))
         {
-            Msg_DamageMinion state_data;
-            memcpy(&state_data, buffer, sizeof(Msg_DamageMinion));
-
-            state_data.message_type = MSG_TYPE_S_DAMAGE_MINION;     // Change type for broadcast
-            NetServer_BroadcastMessage(ns_state, &state_data, sizeof(Msg_DamageMinion), client_index);
+            // damageMinion ignores indices outside the minion pool
+            if (state->is_dedicated)
+            {
+                damageMinion(*state, damage_minion.minionIndex, 0, false, damage_minion.current_health);
+            }
+            damage_minion.message_type = MSG_TYPE_S_DAMAGE_MINION;     // Change type for broadcast
+            encoded_length = NetCodec_EncodeDamageMinion(&damage_minion, encoded, sizeof(encoded));
+            if (encoded_length > 0)
+            {
+                NetServer_BroadcastMessage(ns_state, encoded, encoded_length, client_index);
+            }
         }
         else 
         {
-            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Server] Rcvd incomplete C_DAMAGE_MINION msg from client %u (%d bytes, needed %lu)", (unsigned int)sender_id, bytesReceived, (unsigned long)sizeof(Msg_DamageMinion));
+            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Server] Rcvd truncated C_DAMAGE_MINION msg from client %u (%d bytes)", (unsigned int)sender_id, bytesReceived);
         }
         break;
 
@@ -302,17 +769,23 @@ static void internal_process_client_message(NetServerState ns_state, int client_
             SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Server] Received C_DAMAGE_TOWER from client ID %u not in WELCOMED state (%d). Ignoring.", (unsigned int)sender_id, client_info->status);
             break;
         }
-        if (bytesReceived >= (int)sizeof(Msg_DamageTower))
+        Msg_DamageTower damage_tower;
+        if (NetCodec_DecodeDamageTower(buffer, bytesReceived, &damage_tower))
         {
-            Msg_DamageTower state_data;
-            memcpy(&state_data, buffer, sizeof(Msg_DamageTower));
-
-            state_data.message_type = MSG_TYPE_S_DAMAGE_TOWER; // Change type for broadcast
-            NetServer_BroadcastMessage(ns_state, &state_data, sizeof(Msg_DamageTower), client_index);
+            if (state->is_dedicated && damage_tower.towerIndex >= 0 && damage_tower.towerIndex < MAX_TOTAL_TOWERS)
+            {
+                damageTower(*state, damage_tower.towerIndex, damage_tower.damageValue, false, damage_tower.current_health);
+            }
+            damage_tower.message_type = MSG_TYPE_S_DAMAGE_TOWER; // Change type for broadcast
+            encoded_length = NetCodec_EncodeDamageTower(&damage_tower, encoded, sizeof(encoded));
+            if (encoded_length > 0)
+            {
+                NetServer_BroadcastMessage(ns_state, encoded, encoded_length, client_index);
+            }
         }
         else
         {
-            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Server] Rcvd incomplete C_DAMAGE_TOWER msg from client %u (%d bytes, needed %lu)", (unsigned int)sender_id, bytesReceived, (unsigned long)sizeof(Msg_DamageTower));
+            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Server] Rcvd truncated C_DAMAGE_TOWER msg from client %u (%d bytes)", (unsigned int)sender_id, bytesReceived);
         }
         break;
 
@@ -322,17 +795,23 @@ static void internal_process_client_message(NetServerState ns_state, int client_
             SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Server] Received C_DAMAGE_BASE from client ID %u not in WELCOMED state (%d). Ignoring.", (unsigned int)sender_id, client_info->status);
             break;
         }
-        if (bytesReceived >= (int)sizeof(Msg_DamageBase))
+        Msg_DamageBase damage_base;
+        if (NetCodec_DecodeDamageBase(buffer, bytesReceived, &damage_base))
         {
-            Msg_DamageBase state_data;
-            memcpy(&state_data, buffer, sizeof(Msg_DamageBase));
-
-            state_data.message_type = MSG_TYPE_S_DAMAGE_BASE; // Change type for broadcast
-            NetServer_BroadcastMessage(ns_state, &state_data, sizeof(Msg_DamageBase), client_index);
+            if (state->is_dedicated && damage_base.baseIndex >= 0 && damage_base.baseIndex < MAX_BASES)
+            {
+                damageBase(state, damage_base.baseIndex, damage_base.damageValue, false);
+            }
+            damage_base.message_type = MSG_TYPE_S_DAMAGE_BASE; // Change type for broadcast
+            encoded_length = NetCodec_EncodeDamageBase(&damage_base, encoded, sizeof(encoded));
+            if (encoded_length > 0)
+            {
+                NetServer_BroadcastMessage(ns_state, encoded, encoded_length, client_index);
+            }
         }
         else
         {
-            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Server] Rcvd incomplete C_DAMAGE_BASE msg from client %u (%d bytes, needed %lu)", (unsigned int)sender_id, bytesReceived, (unsigned long)sizeof(Msg_DamageBase));
+            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Server] Rcvd truncated C_DAMAGE_BASE msg from client %u (%d bytes)", (unsigned int)sender_id, bytesReceived);
         }
         break;
 
@@ -342,16 +821,25 @@ static void internal_process_client_message(NetServerState ns_state, int client_
             SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Server] Received C_MATCH_RESULT from client ID %u not in WELCOMED state (%d). Ignoring.", (unsigned int)sender_id, client_info->status);
             break;
         }
-        if (bytesReceived >= (int)sizeof(Msg_MatchResult))
+        Msg_MatchResult match_result;
+        if (NetCodec_DecodeMatchResult(buffer, bytesReceived, &match_result))
         {
-            Msg_MatchResult state_data;
-            memcpy(&state_data, buffer, sizeof(Msg_MatchResult));
-            state_data.message_type = MSG_TYPE_S_GAME_RESULT; // Change type for broadcast
-            NetServer_BroadcastMessage(ns_state, &state_data, sizeof(Msg_MatchResult), client_index);
+            if (state->is_dedicated && state->currentGameState != GAME_STATE_FINISHED)
+            {
+                SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[Server] Match won by team %s.", match_result.winningTeam ? "RED" : "BLUE");
+                state->winningTeam = match_result.winningTeam;
+                state->currentGameState = GAME_STATE_FINISHED;
+            }
+            match_result.message_type = MSG_TYPE_S_GAME_RESULT; // Change type for broadcast
+            encoded_length = NetCodec_EncodeMatchResult(&match_result, encoded, sizeof(encoded));
+            if (encoded_length > 0)
+            {
+                NetServer_BroadcastMessage(ns_state, encoded, encoded_length, client_index);
+            }
         }
         else
         {
-            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Server] Rcvd incomplete C_MATCH_RESULT msg from client %u (%d bytes, needed %lu)", (unsigned int)sender_id, bytesReceived, (unsigned long)sizeof(Msg_MatchResult));
+            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Server] Rcvd truncated C_MATCH_RESULT msg from client %u (%d bytes)", (unsigned int)sender_id, bytesReceived);
         }
         break;
 
@@ -361,6 +849,33 @@ static void internal_process_client_message(NetServerState ns_state, int client_
     }
 }
 
+/**
+ * @brief Puts a new connection into a free slot, in the ACCEPTED state.
+ * @param ns_state The NetServerState instance.
+ * @param client_index The free slot.
+ * @param socket The connection, now owned by the slot.
+ */
+static void assign_client_slot(NetServerState ns_state, int client_index, SDLNet_StreamSocket *socket)
+{
+    ServerClientInfo *client_info = &ns_state->clients[client_index];
+    client_info->socket = socket;
+    client_info->status = CLIENT_STATE_ACCEPTED;
+    client_info->client_id = (uint8_t)client_index; // Use index as ID for simplicity
+    NetFrame_ResetRecvBuffer(&client_info->recv_buffer);
+    NetFrame_ResetSendQueue(&client_info->send_queue);
+    reset_state_links(ns_state, client_index);
+    client_info->team = false;
+    client_info->player_spawned = false;
+    client_info->spawn_allowed = true;
+    client_info->has_input = false;
+    client_info->input_budget = SERVER_INPUT_BURST;
+    client_info->input_queue_head = 0;
+    client_info->input_queue_count = 0;
+    client_info->input_ack_pending = false;
+    client_info->has_relayed_state = false;
+    ns_state->connected_clients_count++;
+}
+
 /**
  * @brief Checks for and accepts a new client connection if a slot is available.
  * Assigns a client ID and sets the initial state to ACCEPTED.
@@ -382,12 +897,8 @@ static void accept_new_client(NetServerState ns_state, AppState *state)
             int client_index = find_inactive_client_slot(ns_state);
             if (client_index != -1)
             {
-                ServerClientInfo *client_info = &ns_state->clients[client_index];
-                client_info->socket = new_client_socket;
-                client_info->status = CLIENT_STATE_ACCEPTED;
-                client_info->client_id = (uint8_t)client_index; // Use index as ID for simplicity
-                ns_state->connected_clients_count++;
-                SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[Server] Accepted new client connection, assigned ID %u at index %d. Waiting for C_HELLO.", (unsigned int)client_info->client_id, client_index);
+                assign_client_slot(ns_state, client_index, new_client_socket);
+                SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[Server] Accepted new client connection, assigned ID %u at index %d. Waiting for C_HELLO.", (unsigned int)client_index, client_index);
             }
             else
             {
@@ -403,8 +914,9 @@ static void accept_new_client(NetServerState ns_state, AppState *state)
 }
 
 /**
- * @brief Reads data from all active clients and processes received messages.
- * Handles disconnects if reads fail or indicate a closed connection.
+ * @brief Reads data from all active clients and dispatches every complete frame received.
+ * Bytes are accumulated per client so coalesced or fragmented frames are handled correctly.
+ * Handles disconnects if reads fail, indicate a closed connection, or the stream is corrupt.
  * @param ns_state The NetServerState instance.
  * @param state The main AppState instance.
  */
@@ -413,10 +925,10 @@ static void receive_from_all_clients(NetServerState ns_state, AppState *state)
     if (!ns_state)
         return;
 
-    char buffer[BUFFER_SIZE];
+    char payload[NET_FRAME_MAX_PAYLOAD];
     bool client_disconnected[MAX_CLIENTS] = {false}; // Track disconnects during read loop
 
-    for (int i = 0; i < MAX_CLIENTS; ++i)
+    for (int i = 0; i < ns_state->max_clients; ++i)
     {
         if (ns_state->clients[i].status == CLIENT_STATE_INACTIVE)
             continue;
@@ -428,23 +940,9 @@ static void receive_from_all_clients(NetServerState ns_state, AppState *state)
         while (client_info->status != CLIENT_STATE_INACTIVE && bytesReceived > 0)
         {
             SDL_ClearError();
-            bytesReceived = SDLNet_ReadFromStreamSocket(client_info->socket, buffer, sizeof(buffer));
+            bytesReceived = NetFrame_ReadFromSocket(&client_info->recv_buffer, client_info->socket);
 
-            if (bytesReceived > 0)
-            {
-                internal_process_client_message(ns_state, i, buffer, bytesReceived, state);
-                // Check status again in case processing caused disconnect
-                if (client_info->status == CLIENT_STATE_INACTIVE)
-                {
-                    break;
-                }
-            }
-            else if (bytesReceived == 0)
-            {
-                // No more data available for this client right now
-                break;
-            }
-            else // bytesReceived < 0 indicates error or closed connection
+            if (bytesReceived < 0) // Error or closed connection
             {
                 const char *sdlError = SDL_GetError();
                 if (sdlError && sdlError[0] != '\0' &&
@@ -461,11 +959,25 @@ static void receive_from_all_clients(NetServerState ns_state, AppState *state)
                 client_disconnected[i] = true;
                 break; // Stop reading from this client
             }
+
+            // Dispatch every complete frame currently buffered
+            int frameLength = 0;
+            while (client_info->status != CLIENT_STATE_INACTIVE &&
+                   (frameLength = NetFrame_PopFrame(&client_info->recv_buffer, payload, sizeof(payload))) > 0)
+            {
+                internal_process_client_message(ns_state, i, payload, frameLength, state);
+            }
+            if (frameLength < 0)
+            {
+                SDL_LogError(SDL_LOG_CATEGORY_ERROR, "[Server] Corrupt stream from client ID %u: %s. Marking for disconnect.", (unsigned int)client_info->client_id, SDL_GetError());
+                client_disconnected[i] = true;
+                break;
+            }
         }
     }
 
     // Process disconnections after checking all clients
-    for (int i = 0; i < MAX_CLIENTS; ++i)
+    for (int i = 0; i < ns_state->max_clients; ++i)
     {
         if (client_disconnected[i])
         {
@@ -478,8 +990,103 @@ static void receive_from_all_clients(NetServerState ns_state, AppState *state)
     }
 }
 
+/**
+ * @brief Binds a client's datagram endpoint after a valid C_UDP_HELLO and confirms it on the stream.
+ * Repeated hellos from an already bound client are answered again in case S_UDP_READY is still in flight.
+ * @param ns_state The NetServerState instance.
+ * @param datagram The received C_UDP_HELLO datagram.
+ * @return False if the hello does not match a welcomed client of this server.
+ */
+static bool handle_udp_hello(NetServerState ns_state, SDLNet_Datagram *datagram)
+{
+    Msg_UdpHelloData hello;
+    if (!NetCodec_DecodeUdpHello(datagram->buf, datagram->buflen, &hello) || hello.client_id >= ns_state->max_clients)
+    {
+        return false;
+    }
+
+    ServerClientInfo *client_info = &ns_state->clients[hello.client_id];
+    if (client_info->status != CLIENT_STATE_WELCOMED || client_info->session_token != hello.session_token)
+    {
+        return false;
+    }
+
+    if (!client_info->udp_address || client_info->udp_port != datagram->port ||
+        SDLNet_CompareAddresses(client_info->udp_address, datagram->addr) != 0)
+    {
+        unbind_udp_endpoint(client_info);
+        client_info->udp_address = SDLNet_RefAddress(datagram->addr);
+        client_info->udp_port = datagram->port;
+        SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[Server] Bound datagram endpoint %s:%u for client ID %u.", SDLNet_GetAddressString(datagram->addr), (unsigned int)datagram->port, (unsigned int)hello.client_id);
+    }
+
+    Uint8 ready = MSG_TYPE_S_UDP_READY;
+    if (!send_to_client(client_info, &ready, sizeof(ready)))
+    {
+        disconnect_client(ns_state, hello.client_id);
+    }
+    return true;
+}
+
+/**
+ * @brief Reads every pending datagram and dispatches it.
+ * A room server does not read its socket; the RoomHost hands it its datagrams instead.
+ * @param ns_state The NetServerState instance.
+ * @param state The main AppState instance.
+ */
+static void receive_datagrams(NetServerState ns_state, AppState *state)
+{
+    if (!ns_state->udp_socket || ns_state->shares_sockets)
+        return;
+
+    SDLNet_Datagram *datagram = NULL;
+    while (SDLNet_ReceiveDatagram(ns_state->udp_socket, &datagram) && datagram)
+    {
+        if (!NetServer_HandleDatagram(ns_state, datagram, state) && datagram->buflen > 0 && datagram->buf[0] == MSG_TYPE_C_UDP_HELLO)
+        {
+            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Server] Ignoring C_UDP_HELLO with bad client ID or token.");
+        }
+        SDLNet_DestroyDatagram(datagram);
+        datagram = NULL;
+    }
+}
+
 // --- Static Callback Functions (for EntityManager) ---
 
+/**
+ * @brief Drives the match on a dedicated server, where no host is present to press start.
+ * Starts the game once enough clients have joined, drops the players of freed slots
+ * from the simulation, and shuts down once a finished match has no clients left.
+ * @param ns_state The NetServerState instance.
+ * @param state Pointer to the main AppState.
+ */
+static void update_dedicated_session(NetServerState ns_state, AppState *state)
+{
+    int welcomed_count = 0;
+    for (int i = 0; i < ns_state->max_clients; ++i)
+    {
+        if (ns_state->clients[i].status == CLIENT_STATE_WELCOMED)
+        {
+            welcomed_count++;
+        }
+        else if (ns_state->clients[i].status == CLIENT_STATE_INACTIVE)
+        {
+            PlayerManager_RemovePlayer(state->player_manager, (uint8_t)i); // Slot index doubles as client ID
+        }
+    }
+
+    if (state->currentGameState == GAME_STATE_LOBBY && welcomed_count >= state->dedicated_start_players)
+    {
+        SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[Server] %d player(s) joined. Starting match.", welcomed_count);
+        NetServer_StartGame(ns_state, state);
+    }
+    else if (state->currentGameState == GAME_STATE_FINISHED && ns_state->connected_clients_count == 0)
+    {
+        SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[Server] Match over and all clients left. Shutting down.");
+        state->quit_requested = true;
+    }
+}
+
 /**
  * @brief Wrapper function conforming to EntityFunctions.update signature.
  * @param manager The EntityManager instance.
@@ -492,8 +1099,96 @@ static void net_server_update_callback(EntityManager manager, AppState *state)
     if (!ns_state)
         return;
 
+    // Every client may apply one more input command per tick, starting with the ones already waiting
+    for (int i = 0; i < ns_state->max_clients; ++i)
+    {
+        ServerClientInfo *client_info = &ns_state->clients[i];
+        client_info->input_budget = SDL_min(client_info->input_budget + 1, SERVER_INPUT_BURST);
+        if (client_info->status == CLIENT_STATE_WELCOMED)
+        {
+            apply_queued_inputs(client_info, state);
+        }
+    }
+
     accept_new_client(ns_state, state);
     receive_from_all_clients(ns_state, state);
+    receive_datagrams(ns_state, state);
+    relay_distant_player_states(ns_state);
+
+    if (state->is_dedicated)
+    {
+        update_dedicated_session(ns_state, state);
+    }
+}
+
+/**
+ * @brief Writes every client's queued messages for this tick in one call per client.
+ * Clients whose write fails are disconnected after all queues have been flushed.
+ * Inputs applied this tick are answered with S_INPUT_ACK, and player states received
+ * over UDP this tick are acknowledged with one datagram per client.
+ * @param ns_state The NetServerState instance.
+ */
+static void flush_all_clients(NetServerState ns_state)
+{
+    if (!ns_state)
+        return;
+
+    bool client_disconnected[MAX_CLIENTS] = {false};
+
+    for (int i = 0; i < ns_state->max_clients; ++i)
+    {
+        ServerClientInfo *client_info = &ns_state->clients[i];
+        if (client_info->status == CLIENT_STATE_INACTIVE)
+            continue;
+
+        if ((client_info->input_ack_pending && !send_input_ack(ns_state, client_info)) ||
+            !NetFrame_FlushSendQueue(&client_info->send_queue, client_info->socket))
+        {
+            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Server] Flush failed for client ID %u: %s. Marking for disconnect.", (unsigned int)client_info->client_id, SDL_GetError());
+            client_disconnected[i] = true;
+            continue;
+        }
+
+        if (client_info->state_ack_pending)
+        {
+            Msg_StateAckData ack;
+            ack.message_type = MSG_TYPE_S_STATE_ACK;
+            ack.count = 1;
+            ack.entries[0].client_id = client_info->client_id;
+            ack.entries[0].seq = client_info->state_rx.latest_seq;
+            Uint8 encoded[NET_CODEC_MAX_MESSAGE_SIZE];
+            int encoded_length = NetCodec_EncodeStateAck(&ack, encoded, sizeof(encoded));
+            if (encoded_length > 0)
+            {
+                send_datagram_to_client(ns_state, client_info, encoded, encoded_length);
+            }
+            client_info->state_ack_pending = false;
+        }
+    }
+
+    for (int i = 0; i < ns_state->max_clients; ++i)
+    {
+        if (client_disconnected[i] && ns_state->clients[i].status != CLIENT_STATE_INACTIVE)
+        {
+            disconnect_client(ns_state, i); // Disconnect notices go out with the next flush
+        }
+    }
+}
+
+/**
+ * @brief Wrapper function conforming to EntityFunctions.late_update signature.
+ * Flushes the per-client batches built up during this tick's update pass.
+ * @param manager The EntityManager instance.
+ * @param state Pointer to the main AppState.
+ */
+static void net_server_late_update_callback(EntityManager manager, AppState *state)
+{
+    (void)manager; // Manager instance is not used in this specific implementation
+    NetServerState ns_state = state ? state->net_server_state : NULL;
+    if (!ns_state)
+        return;
+
+    flush_all_clients(ns_state);
 }
 
 /**
@@ -511,9 +1206,14 @@ static void net_server_cleanup_callback(EntityManager manager, AppState *state)
     }
 }
 
-// --- Public API Function Implementations ---
-
-NetServerState NetServer_Init(AppState *state)
+/**
+ * @brief Creates a server and registers its entity functions.
+ * @param state Pointer to the main AppState.
+ * @param room_id Room the server runs.
+ * @param shared_udp_socket The RoomHost's datagram socket for a room server, or NULL to open its own sockets.
+ * @return A new NetServerState instance on success, NULL on failure.
+ */
+static NetServerState create_server(AppState *state, Uint16 room_id, SDLNet_DatagramSocket *shared_udp_socket)
 {
     if (!state || !state->entity_manager)
     {
@@ -535,24 +1235,56 @@ NetServerState NetServer_Init(AppState *state)
 
     ns_state->listen_socket = NULL;
     ns_state->connected_clients_count = 0;
-    for (int i = 0; i < MAX_CLIENTS; ++i)
+    ns_state->max_clients = CLAMP(state->max_players, 1, MAX_CLIENTS);
+    ns_state->room_id = room_id;
+
+    // One state link per (receiving client, source client) pair
+    ns_state->clients = (ServerClientInfo *)SDL_calloc((size_t)ns_state->max_clients, sizeof(ServerClientInfo));
+    ns_state->state_tx_pool = (NetDeltaSender *)SDL_calloc((size_t)(ns_state->max_clients * ns_state->max_clients), sizeof(NetDeltaSender));
+    if (!ns_state->clients || !ns_state->state_tx_pool)
+    {
+        SDL_OutOfMemory();
+        SDL_free(ns_state->clients);
+        SDL_free(ns_state->state_tx_pool);
+        SDL_free(ns_state);
+        return NULL;
+    }
+    for (int i = 0; i < ns_state->max_clients; ++i)
     {
         ns_state->clients[i].status = CLIENT_STATE_INACTIVE;
         ns_state->clients[i].socket = NULL;
+        ns_state->clients[i].state_tx = &ns_state->state_tx_pool[i * ns_state->max_clients];
     }
 
-    ns_state->listen_socket = SDLNet_CreateServer(NULL, SERVER_PORT);
-    if (!ns_state->listen_socket)
+    if (shared_udp_socket)
     {
-        SDL_LogError(SDL_LOG_CATEGORY_ERROR, "[Server Init] SDLNet_CreateServer failed: %s", SDL_GetError());
-        SDL_free(ns_state);
-        return NULL;
+        ns_state->udp_socket = shared_udp_socket;
+        ns_state->shares_sockets = true;
+    }
+    else
+    {
+        ns_state->listen_socket = SDLNet_CreateServer(NULL, SERVER_PORT);
+        if (!ns_state->listen_socket)
+        {
+            SDL_LogError(SDL_LOG_CATEGORY_ERROR, "[Server Init] SDLNet_CreateServer failed: %s", SDL_GetError());
+            SDL_free(ns_state->clients);
+            SDL_free(ns_state->state_tx_pool);
+            SDL_free(ns_state);
+            return NULL;
+        }
+        SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[Server] Listening on port %d...", SERVER_PORT);
+
+        ns_state->udp_socket = SDLNet_CreateDatagramSocket(NULL, SERVER_PORT);
+        if (!ns_state->udp_socket)
+        {
+            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[Server Init] SDLNet_CreateDatagramSocket failed: %s. Player state will use TCP only.", SDL_GetError());
+        }
     }
-    SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[Server] Listening on port %d...", SERVER_PORT);
 
     EntityFunctions net_server_funcs = {
         .name = "net_server",
         .update = net_server_update_callback,
+        .late_update = net_server_late_update_callback,
         .cleanup = net_server_cleanup_callback,
         .render = NULL,
         .handle_events = NULL};
@@ -562,11 +1294,36 @@ NetServerState NetServer_Init(AppState *state)
         SDL_LogError(SDL_LOG_CATEGORY_ERROR, "[Server Init] Failed to add entity to manager: %s", SDL_GetError());
         if (ns_state->listen_socket)
             SDLNet_DestroyServer(ns_state->listen_socket);
+        if (ns_state->udp_socket && !ns_state->shares_sockets)
+            SDLNet_DestroyDatagramSocket(ns_state->udp_socket);
+        SDL_free(ns_state->clients);
+        SDL_free(ns_state->state_tx_pool);
         SDL_free(ns_state);
         return NULL;
     }
 
-    SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "NetServer module initialized and entity registered.");
+    return ns_state;
+}
+
+// --- Public API Function Implementations ---
+
+NetServerState NetServer_Init(AppState *state)
+{
+    NetServerState ns_state = create_server(state, 0, NULL);
+    if (ns_state)
+    {
+        SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "NetServer module initialized and entity registered.");
+    }
+    return ns_state;
+}
+
+NetServerState NetServer_InitRoom(AppState *state, Uint16 room_id, SDLNet_DatagramSocket *udp_socket)
+{
+    NetServerState ns_state = create_server(state, room_id, udp_socket);
+    if (ns_state)
+    {
+        SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "NetServer for room %u initialized and entity registered.", (unsigned int)room_id);
+    }
     return ns_state;
 }
 
@@ -577,25 +1334,35 @@ void NetServer_Destroy(NetServerState ns_state)
 
     SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "Destroying NetServerState...");
 
-    for (int i = 0; i < MAX_CLIENTS; ++i)
+    for (int i = 0; i < ns_state->max_clients; ++i)
     {
         if (ns_state->clients[i].status != CLIENT_STATE_INACTIVE)
         {
             if (ns_state->clients[i].socket)
             {
+                NetFrame_FlushSendQueue(&ns_state->clients[i].send_queue, ns_state->clients[i].socket); // Best effort
                 SDLNet_DestroyStreamSocket(ns_state->clients[i].socket);
                 ns_state->clients[i].socket = NULL;
             }
+            unbind_udp_endpoint(&ns_state->clients[i]);
             ns_state->clients[i].status = CLIENT_STATE_INACTIVE;
         }
     }
 
+    if (ns_state->udp_socket && !ns_state->shares_sockets)
+    {
+        SDLNet_DestroyDatagramSocket(ns_state->udp_socket);
+    }
+    ns_state->udp_socket = NULL;
+
     if (ns_state->listen_socket)
     {
         SDLNet_DestroyServer(ns_state->listen_socket);
         ns_state->listen_socket = NULL;
     }
 
+    SDL_free(ns_state->clients);
+    SDL_free(ns_state->state_tx_pool);
     SDL_free(ns_state);
     SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "NetServerState container destroyed.");
 }
@@ -604,3 +1371,69 @@ void NetServer_BroadcastMessage(NetServerState ns_state, const void *buffer, int
 {
     internal_broadcast_message_impl(ns_state, buffer, length, exclude_client_index);
 }
+
+void NetServer_StartGame(NetServerState ns_state, AppState *state)
+{
+    if (!state)
+        return;
+
+    Uint64 now = SDL_GetTicks();
+    state->currentGameState = GAME_STATE_PLAYING;
+    // The server's clock is the shared clock
+    state->clock_offset_ms = 0;
+    state->clock_target_offset_ms = 0;
+    state->clock_synced = true;
+
+    if (!ns_state)
+        return;
+
+    Msg_GameStart msg;
+    msg.message_type = MSG_TYPE_S_GAME_START;
+    msg.server_start_time_stamp = now;
+    Uint8 encoded[NET_CODEC_MAX_MESSAGE_SIZE];
+    int encoded_length = NetCodec_EncodeGameStart(&msg, encoded, sizeof(encoded));
+    if (encoded_length > 0)
+    {
+        internal_broadcast_message_impl(ns_state, encoded, encoded_length, -1);
+    }
+}
+
+bool NetServer_AdoptClient(NetServerState ns_state, SDLNet_StreamSocket *socket, const void *hello, int hello_length, AppState *state)
+{
+    if (!ns_state || !socket || !hello || hello_length <= 0 || hello_length > NET_FRAME_MAX_PAYLOAD || !state)
+        return SDL_SetError("Invalid arguments for NetServer_AdoptClient");
+
+    int client_index = find_inactive_client_slot(ns_state);
+    if (client_index < 0)
+        return SDL_SetError("Room %u is full", (unsigned int)ns_state->room_id);
+
+    assign_client_slot(ns_state, client_index, socket);
+    SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[Server] Room %u adopted a client connection at index %d.", (unsigned int)ns_state->room_id, client_index);
+
+    // The hello was read by the RoomHost; answering it here sends S_WELCOME as for a direct connection
+    char payload[NET_FRAME_MAX_PAYLOAD];
+    SDL_memcpy(payload, hello, (size_t)hello_length);
+    internal_process_client_message(ns_state, client_index, payload, hello_length, state);
+    return true;
+}
+
+bool NetServer_HandleDatagram(NetServerState ns_state, SDLNet_Datagram *datagram, AppState *state)
+{
+    if (!ns_state || !datagram || datagram->buflen <= 0)
+        return false;
+
+    if (datagram->buf[0] == MSG_TYPE_C_UDP_HELLO)
+    {
+        return handle_udp_hello(ns_state, datagram);
+    }
+    if (datagram->buf[0] == MSG_TYPE_C_PLAYER_STATE || datagram->buf[0] == MSG_TYPE_C_PLAYER_INPUT ||
+        datagram->buf[0] == MSG_TYPE_C_STATE_ACK || datagram->buf[0] == MSG_TYPE_C_TIME_PING)
+    {
+        int client_index = find_client_by_udp_endpoint(ns_state, datagram->addr, datagram->port);
+        if (client_index < 0)
+            return false;
+        internal_process_client_message(ns_state, client_index, (char *)datagram->buf, datagram->buflen, state);
+        return true;
+    }
+    return false;
+}
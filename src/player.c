@@ -12,14 +12,168 @@ static void playerDeathTimer(PlayerInstance *p)
         p->dead = false;
         p->playDeathAnim = false;
         p->current_health = PLAYER_HEALTH_MAX;
-        p->position = p->team ? (SDL_FPoint){BASE_RED_POS_X + 300, BUILDINGS_POS_Y} : (SDL_FPoint){BASE_BLUE_POS_X - 300, BUILDINGS_POS_Y};
+        p->position = Player_GetSpawnPosition(p->team);
+        p->prev_position = p->position; // Respawn is a teleport, not movement
+        p->spawn_pending = true;
+    }
+}
+
+/**
+ * @brief Rebuilds a player's collision rect from its position.
+ * @param p Pointer to the PlayerInstance.
+ */
+static void update_player_rect(PlayerInstance *p)
+{
+    p->rect = (SDL_FRect){
+        p->position.x - PLAYER_WIDTH / 2.0f,
+        p->position.y - PLAYER_HEIGHT / 2.0f,
+        PLAYER_WIDTH,
+        PLAYER_HEIGHT};
+}
+
+/**
+ * @brief Tells whether a snapshot shows the walk animation, i.e. the player was moving.
+ * @param snapshot The snapshot.
+ * @return True if the player was walking.
+ */
+static bool snapshot_is_walking(const PlayerSnapshot *snapshot)
+{
+    return fabsf(snapshot->sprite_portion.y - PLAYER_SPRITE_WALK_ROW_Y) < 0.1f;
+}
+
+/**
+ * @brief Appends a snapshot to a remote player's buffer, dropping the oldest when full.
+ * @param p Pointer to the remote PlayerInstance.
+ * @param snapshot The snapshot to append.
+ */
+static void append_snapshot(PlayerInstance *p, const PlayerSnapshot *snapshot)
+{
+    if (p->snapshot_count == PLAYER_SNAPSHOT_COUNT)
+    {
+        memmove(&p->snapshots[0], &p->snapshots[1], (PLAYER_SNAPSHOT_COUNT - 1) * sizeof(PlayerSnapshot));
+        p->snapshot_count--;
+    }
+    p->snapshots[p->snapshot_count++] = *snapshot;
+}
+
+/**
+ * @brief Buffers a received state and updates the estimate of the owner's clock.
+ * @param p Pointer to the remote PlayerInstance.
+ * @param data The received state.
+ * @param now Current local tick in ms.
+ */
+static void push_remote_snapshot(PlayerInstance *p, const Msg_PlayerStateData *data, Sint64 now)
+{
+    PlayerSnapshot snapshot;
+    snapshot.time = data->timestamp;
+    snapshot.position = data->position;
+    snapshot.sprite_portion = (SDL_FRect){
+        (float)data->anim_frame * PLAYER_SPRITE_FRAME_WIDTH,
+        (float)data->anim_row * PLAYER_SPRITE_FRAME_HEIGHT,
+        PLAYER_SPRITE_FRAME_WIDTH,
+        PLAYER_SPRITE_FRAME_HEIGHT};
+    snapshot.current_frame = data->anim_frame;
+    snapshot.flip_mode = data->flip_mode;
+
+    if (p->snapshot_count > 0)
+    {
+        // States arrive at least once per keepalive, far less than the 16-bit wrap
+        const PlayerSnapshot *newest = &p->snapshots[p->snapshot_count - 1];
+        snapshot.time = newest->time + (Sint16)(data->timestamp - (Uint16)newest->time);
+        if (snapshot.time <= newest->time)
+            return;
+
+        // A player standing still sends nothing, so a long gap after an idle state means it
+        // stood there until shortly before this state, not that it moved slowly all along
+        if (!snapshot_is_walking(newest) && snapshot.time - newest->time > 2 * PLAYER_STATE_INTERVAL_MS)
+        {
+            PlayerSnapshot hold = *newest;
+            hold.time = snapshot.time - PLAYER_STATE_INTERVAL_MS;
+            append_snapshot(p, &hold);
+        }
+    }
+
+    // Late states give larger samples, so the offset follows the smallest one and only creeps up to absorb drift
+    Sint64 offset = now - snapshot.time;
+    if (p->snapshot_count == 0 || offset < p->clock_offset)
+        p->clock_offset = offset;
+    else
+        p->clock_offset++;
+
+    append_snapshot(p, &snapshot);
+}
+
+/**
+ * @brief Places a remote player where its buffered states put it at the given time.
+ * Interpolates between the two states around render_time. Past the newest state a walking
+ * player is extrapolated for up to PLAYER_EXTRAPOLATION_MAX_MS; an idle one stays put.
+ * @param p Pointer to the remote PlayerInstance (at least one snapshot).
+ * @param render_time Time on the owner's clock to show.
+ */
+static void apply_remote_snapshots(PlayerInstance *p, Sint64 render_time)
+{
+    const PlayerSnapshot *newest = &p->snapshots[p->snapshot_count - 1];
+    const PlayerSnapshot *shown = &p->snapshots[0];
+    SDL_FPoint position = shown->position;
+
+    if (render_time >= newest->time)
+    {
+        shown = newest;
+        position = newest->position;
+        if (p->snapshot_count >= 2 && snapshot_is_walking(newest))
+        {
+            const PlayerSnapshot *previous = &p->snapshots[p->snapshot_count - 2];
+            Sint64 ahead = SDL_min(render_time - newest->time, PLAYER_EXTRAPOLATION_MAX_MS);
+            float t = 1.0f + (float)ahead / (float)(newest->time - previous->time);
+            position.x = LERP(previous->position.x, newest->position.x, t);
+            position.y = LERP(previous->position.y, newest->position.y, t);
+        }
+    }
+    else
+    {
+        for (int i = p->snapshot_count - 1; i > 0; --i)
+        {
+            const PlayerSnapshot *from = &p->snapshots[i - 1];
+            if (from->time <= render_time)
+            {
+                const PlayerSnapshot *to = &p->snapshots[i];
+                float t = (float)(render_time - from->time) / (float)(to->time - from->time);
+                position.x = LERP(from->position.x, to->position.x, t);
+                position.y = LERP(from->position.y, to->position.y, t);
+                shown = from;
+                break;
+            }
+        }
+    }
+
+    p->position = position;
+    p->sprite_portion = shown->sprite_portion;
+    p->current_frame = shown->current_frame;
+    p->flip_mode = shown->flip_mode;
+    p->is_moving = snapshot_is_walking(shown);
+    update_player_rect(p);
+}
+
+/**
+ * @brief Records a local input command so it can be sent and later replayed.
+ * If the server falls a full history behind, the oldest command is treated as acknowledged.
+ * @param pm The PlayerManager instance.
+ * @param buttons PLAYER_INPUT_* bits of the command.
+ */
+static void record_input_command(PlayerManager pm, Uint8 buttons)
+{
+    Uint16 seq = pm->next_input_seq++;
+    pm->input_history[seq % PLAYER_INPUT_HISTORY] = (PlayerInputCommand){seq, buttons};
+    if ((Uint16)(pm->next_input_seq - pm->acked_input_seq) > PLAYER_INPUT_HISTORY)
+    {
+        pm->acked_input_seq++;
     }
 }
 
 /**
  * @brief Handles input processing (movement) for the local player.
- * Reads keyboard state, calculates new position based on input and delta time,
- * updates movement state, and clamps position to map boundaries.
+ * Reads keyboard state into an input command, records it for the server and applies it
+ * right away (prediction), then updates the movement state.
  * @param pm The PlayerManager instance.
  * @param state The main application state.
  */
@@ -31,92 +185,36 @@ static void handle_local_player_input(PlayerManager pm, AppState *state)
     PlayerInstance *p = &pm->players[pm->local_player_client_id];
     const bool *keyboard_state = SDL_GetKeyboardState(NULL);
     bool was_moving = p->is_moving; // Track previous state to detect changes for animation reset.
-    p->is_moving = false;
-
-    float move_x = 0.0f;
-    float move_y = 0.0f;
 
     // --- Read Input ---
-    // Accumulate input direction components.
+    Uint8 buttons = 0;
     if (keyboard_state[SDL_SCANCODE_W])
-    {
-        move_y -= 1.0f;
-        p->is_moving = true;
-    }
+        buttons |= PLAYER_INPUT_UP;
     if (keyboard_state[SDL_SCANCODE_S])
-    {
-        move_y += 1.0f;
-        p->is_moving = true;
-    }
+        buttons |= PLAYER_INPUT_DOWN;
     if (keyboard_state[SDL_SCANCODE_A])
     {
-        move_x -= 1.0f;
+        buttons |= PLAYER_INPUT_LEFT;
         p->flip_mode = SDL_FLIP_HORIZONTAL; // Face left when moving left.
-        p->is_moving = true;
     }
     if (keyboard_state[SDL_SCANCODE_D])
     {
-        move_x += 1.0f;
+        buttons |= PLAYER_INPUT_RIGHT;
         p->flip_mode = SDL_FLIP_NONE; // Face right when moving right.
-        p->is_moving = true;
-    }
-
-    // --- Normalize and Apply Movement ---
-    float len_sq = move_x * move_x + move_y * move_y;
-    // Normalize the movement vector only if there is input, prevents division by zero
-    // and ensures consistent speed regardless of direction (diagonal vs cardinal).
-    if (len_sq > 0.001f)
-    {
-        float len = sqrtf(len_sq);
-        move_x = (move_x / len) * PLAYER_SPEED * state->delta_time;
-        move_y = (move_y / len) * PLAYER_SPEED * state->delta_time;
-    }
-
-    // Create Rect of the player
-    SDL_FRect player_bounds = {
-        move_x - PLAYER_WIDTH / 2.0f + p->position.x,
-        move_y - PLAYER_HEIGHT / 2.0f + p->position.y,
-        PLAYER_WIDTH,
-        PLAYER_HEIGHT};
-
-    bool collision = false;
-
-    for (int i = 0; i < MAX_TOTAL_TOWERS; i++)
-    {
-        if (SDL_HasRectIntersectionFloat(&player_bounds, &state->tower_manager->towers[i].rect))
-        {
-            collision = true;
-        }
     }
+    p->is_moving = buttons != 0;
 
-    for (int i = 0; i < MAX_BASES; i++)
+    if (p->spawn_pending)
     {
-        if (SDL_HasRectIntersectionFloat(&player_bounds, &state->base_manager->bases[i].rect))
-        {
-            collision = true;
-        }
+        buttons |= PLAYER_INPUT_SPAWN;
+        p->spawn_pending = false;
     }
 
-    if (!collision) // If player doesn't intersect, update position
-    {
-        p->position.x += move_x;
-        p->position.y += move_y;
-    }
-
-    // --- Clamp Position ---
-    if (state->map_state)
-    {
-        // Prevent player from moving outside the map horizontally.
-        p->position.x = fmaxf(PLAYER_WIDTH / 2.0f, fminf(p->position.x, Map_GetWidthPixels(state->map_state) - PLAYER_WIDTH / 2.0f));
-        // Prevent player from moving outside the map vertically.
-        p->position.y = fmaxf(CLIFF_BOUNDARY, fminf(p->position.y, WATER_BOUNDARY));
-    }
-
-    p->rect = (SDL_FRect){
-        p->position.x - PLAYER_WIDTH / 2.0f,
-        p->position.y - PLAYER_HEIGHT / 2.0f,
-        PLAYER_WIDTH,
-        PLAYER_HEIGHT};
+    // --- Predict ---
+    // The command is applied now; the server's result for it comes back in S_INPUT_ACK.
+    record_input_command(pm, buttons);
+    Player_ApplyInput(state, &p->position, p->team, buttons, state->delta_time);
+    update_player_rect(p);
 
     // --- Animation State Reset ---
     // If movement state changed (started/stopped moving), reset animation to the beginning.
@@ -247,7 +345,7 @@ static void update_player_animation(PlayerInstance *p, float delta_time)
  */
 static void render_single_player(PlayerManager pm, PlayerInstance *p, AppState *state)
 {
-    if (!pm || !p || !p->active || !pm->player_texture || !state || !state->camera_state)
+    if (!pm || !p || !p->active || !p->sprite || !state || !state->camera_state)
     {
         return;
     }
@@ -262,28 +360,25 @@ static void render_single_player(PlayerManager pm, PlayerInstance *p, AppState *
     float cam_y = Camera_GetY(camera);
 
     // Calculate screen coordinates relative to the camera's view.
-    float screen_x = p->position.x - cam_x - PLAYER_WIDTH / 2.0f;
-    float screen_y = p->position.y - cam_y - PLAYER_HEIGHT / 2.0f;
+    float screen_x = LERP(p->prev_position.x, p->position.x, state->render_alpha) - cam_x - PLAYER_WIDTH / 2.0f;
+    float screen_y = LERP(p->prev_position.y, p->position.y, state->render_alpha) - cam_y - PLAYER_HEIGHT / 2.0f;
 
     SDL_FRect dst_rect = {screen_x, screen_y, PLAYER_WIDTH, PLAYER_HEIGHT};
 
-    SDL_RenderTextureRotated(state->renderer,
-                             p->texture,
-                             &p->sprite_portion, // Source rect from atlas
-                             &dst_rect,          // Destination rect on screen
-                             0.0,                // No rotation needed for player sprite
-                             NULL,               // Render around center
-                             p->flip_mode);      // Horizontal flip state
+    SpriteBatch_DrawRegion(state->sprite_batch,
+                           p->sprite,
+                           &p->sprite_portion,    // Frame within the spritesheet region
+                           &dst_rect,             // Destination rect on screen
+                           0.0,                   // No rotation needed for player sprite
+                           p->flip_mode,          // Horizontal flip state
+                           SPRITE_DEPTH_PLAYERS);
 
     char text_buffer[16];
     snprintf(text_buffer, sizeof(text_buffer), "%d/%d", p->current_health, PLAYER_HEALTH_MAX);
 
-    char player_name[32];
-    snprintf(player_name, sizeof(player_name), "player_%d_health_value", p->index);
-
     SDL_Color team_color = p->team ? (SDL_Color){255, 0, 0, 255} : (SDL_Color){0, 0, 255, 255};
 
-    update_hud_instance(state, get_hud_index_by_name(state, player_name), text_buffer,
+    update_hud_instance(state, p->hud_handle, text_buffer,
                         team_color, (SDL_FPoint){screen_x, screen_y - 20}, 1);
 }
 
@@ -291,7 +386,7 @@ static void render_single_player(PlayerManager pm, PlayerInstance *p, AppState *
 
 /**
  * @brief Entity update callback for the PlayerManager.
- * Updates local player input and animation for all active players.
+ * Updates local player input and animation, and moves remote players along their buffered states.
  * @param manager The EntityManager instance (unused).
  * @param state Pointer to the main AppState.
  */
@@ -306,9 +401,22 @@ static void player_manager_update_callback(EntityManager manager, AppState *stat
     // --- Update Local Player ---
     if (pm->local_player_client_id >= 0)
     {
+        pm->players[pm->local_player_client_id].prev_position = pm->players[pm->local_player_client_id].position;
         handle_local_player_input(pm, state);
         update_player_animation(&pm->players[pm->local_player_client_id], state->delta_time);
     }
+
+    // --- Update Remote Players ---
+    Sint64 now = (Sint64)SDL_GetTicks();
+    for (int i = 0; i < MAX_CLIENTS; ++i)
+    {
+        PlayerInstance *p = &pm->players[i];
+        if (!p->active || p->is_local || p->snapshot_count == 0)
+            continue;
+
+        p->prev_position = p->position;
+        apply_remote_snapshots(p, now - p->clock_offset - state->interpolation_delay_ms);
+    }
 }
 
 /**
@@ -404,20 +512,16 @@ static void player_manager_cleanup_callback(EntityManager manager, AppState *sta
         return;
 
     SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "PlayerManager entity cleanup callback triggered.");
-    if (pm->player_texture)
-    {
-        SDL_DestroyTexture(pm->player_texture);
-        pm->player_texture = NULL;
-    }
+    // Sprites belong to the texture atlas, so there is nothing to release here
 }
 
 // --- Public API Function Implementations ---
 
 PlayerManager PlayerManager_Init(AppState *state)
 {
-    if (!state || !state->renderer || !state->entity_manager)
+    if (!state || !state->entity_manager)
     {
-        SDL_SetError("Invalid AppState or missing renderer/entity_manager for PlayerManager_Init");
+        SDL_SetError("Invalid AppState or missing entity_manager for PlayerManager_Init");
         return NULL;
     }
 
@@ -429,6 +533,7 @@ PlayerManager PlayerManager_Init(AppState *state)
     }
 
     pm->local_player_client_id = -1; // Initialize as having no local player yet.
+    pm->next_input_seq = 1;          // Sequence 0 stands for "nothing acknowledged yet".
     for (int i = 0; i < MAX_CLIENTS; ++i)
     {
         pm->players[i].active = false;
@@ -436,24 +541,9 @@ PlayerManager PlayerManager_Init(AppState *state)
         pm->players[i].team = state->team;
     }
 
-    pm->blue_texture = IMG_LoadTexture(state->renderer, BLUE_WIZARD_PATH);
-    pm->red_texture = IMG_LoadTexture(state->renderer, RED_WIZARD_PATH);
-
-    pm->player_texture = pm->blue_texture;
-
-    if (state->team)
-    {
-        pm->player_texture = pm->red_texture;
-    }
-
-    if (!pm->player_texture)
-    {
-        SDL_LogError(SDL_LOG_CATEGORY_ERROR, "[PlayerManager Init] Failed load texture : %s", SDL_GetError());
-        SDL_free(pm);
-        return NULL;
-    }
-    // Use nearest neighbor scaling for pixel art.
-    SDL_SetTextureScaleMode(pm->player_texture, SDL_SCALEMODE_NEAREST);
+    // Sprites are NULL without a renderer (dedicated server)
+    pm->blue_sprite = TextureAtlas_Get(state->texture_atlas, ATLAS_SPRITE_WIZARD_BLUE);
+    pm->red_sprite = TextureAtlas_Get(state->texture_atlas, ATLAS_SPRITE_WIZARD_RED);
 
     // --- Register with EntityManager ---
     EntityFunctions player_funcs = {
@@ -466,8 +556,6 @@ PlayerManager PlayerManager_Init(AppState *state)
     if (!EntityManager_Add(state->entity_manager, &player_funcs))
     {
         SDL_LogError(SDL_LOG_CATEGORY_ERROR, "[PlayerManager Init] Failed to add entity to manager: %s", SDL_GetError());
-        if (pm->player_texture)
-            SDL_DestroyTexture(pm->player_texture);
         SDL_free(pm);
         return NULL;
     }
@@ -480,7 +568,6 @@ void PlayerManager_Destroy(PlayerManager pm)
 {
     if (pm)
     {
-        pm->player_texture = NULL; // Texture is destroyed in the cleanup callback.
         SDL_free(pm);
         SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "PlayerManager state container destroyed.");
     }
@@ -513,28 +600,20 @@ bool PlayerManager_SetLocalPlayerID(AppState *state, uint8_t client_id)
     current_player->is_moving = false;
     current_player->current_frame = 0;
     current_player->anim_timer = 0.0f;
-    current_player->texture = pm->player_texture;
+    current_player->sprite = current_player->team ? pm->red_sprite : pm->blue_sprite;
     current_player->current_health = PLAYER_HEALTH_MAX;
     current_player->index = client_id;
 
-    // Initial spawn position.
-    current_player->position = (SDL_FPoint){BASE_BLUE_POS_X - 300, BUILDINGS_POS_Y};
-
-    if (current_player->team)
-    {
-        current_player->position = (SDL_FPoint){BASE_RED_POS_X + 300, BUILDINGS_POS_Y};
-    }
-
-    current_player->rect = (SDL_FRect){
-        current_player->position.x - PLAYER_WIDTH / 2.0f,
-        current_player->position.y - PLAYER_HEIGHT / 2.0f,
-        PLAYER_WIDTH,
-        PLAYER_HEIGHT};
+    // Initial spawn position, announced to the server with the first input command.
+    current_player->position = Player_GetSpawnPosition(current_player->team);
+    current_player->prev_position = current_player->position;
+    current_player->spawn_pending = true;
+    update_player_rect(current_player);
 
     char player_name[32];
     snprintf(player_name, sizeof(player_name), "player_%d_health_value", client_id);
 
-    create_hud_instance(state, get_hud_element_count(state->HUD_manager), player_name, true);
+    current_player->hud_handle = create_hud_instance(state, player_name, true);
 
     SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "Local player ID set to %d", client_id);
     return true;
@@ -560,33 +639,25 @@ void PlayerManager_UpdateRemotePlayer(AppState *state, const Msg_PlayerStateData
         pm->players[id].active = true;
         pm->players[id].is_local = false;
         pm->players[id].team = data->team;
-        pm->players[id].texture = pm->blue_texture;
+        pm->players[id].sprite = data->team ? pm->red_sprite : pm->blue_sprite;
         pm->players[id].current_health = data->current_health;
         pm->players[id].index = id;
 
-        if (pm->players[id].team)
-        {
-            pm->players[id].texture = pm->red_texture;
-        }
-
         char player_name[32];
         snprintf(player_name, sizeof(player_name), "player_%d_health_value", id);
 
-        create_hud_instance(state, get_hud_element_count(state->HUD_manager), player_name, true);
+        pm->players[id].hud_handle = create_hud_instance(state, player_name, true);
     }
 
-    // Apply the received state directly.
-    pm->players[id].position = data->position;
-    pm->players[id].sprite_portion = data->sprite_portion;
-    pm->players[id].flip_mode = data->flip_mode;
-    // Infer movement state from the received sprite row for animation purposes.
-    pm->players[id].is_moving = (fabsf(data->sprite_portion.y - PLAYER_SPRITE_WALK_ROW_Y) < 0.1f);
-
-    pm->players[id].rect = (SDL_FRect){
-        pm->players[id].position.x - PLAYER_WIDTH / 2.0f,
-        pm->players[id].position.y - PLAYER_HEIGHT / 2.0f,
-        PLAYER_WIDTH,
-        PLAYER_HEIGHT};
+    // Position and animation follow the buffered states in the update callback; the first one is shown right away.
+    PlayerInstance *p = &pm->players[id];
+    bool first_state = p->snapshot_count == 0;
+    push_remote_snapshot(p, data, (Sint64)SDL_GetTicks());
+    if (first_state)
+    {
+        apply_remote_snapshots(p, p->snapshots[0].time);
+        p->prev_position = p->position;
+    }
 }
 
 void PlayerManager_RemovePlayer(PlayerManager pm, uint8_t client_id)
@@ -619,6 +690,18 @@ bool PlayerManager_GetLocalPlayerPosition(PlayerManager pm, SDL_FPoint *out_pos)
     return false;
 }
 
+bool PlayerManager_GetLocalPlayerRenderPosition(PlayerManager pm, float alpha, SDL_FPoint *out_pos)
+{
+    if (pm && out_pos && pm->local_player_client_id >= 0 && pm->players[pm->local_player_client_id].active)
+    {
+        PlayerInstance *p = &pm->players[pm->local_player_client_id];
+        out_pos->x = LERP(p->prev_position.x, p->position.x, alpha);
+        out_pos->y = LERP(p->prev_position.y, p->position.y, alpha);
+        return true;
+    }
+    return false;
+}
+
 bool PlayerManager_GetPlayerPosition(PlayerManager pm, uint8_t client_id, SDL_FPoint *out_pos)
 {
     if (!pm || !out_pos || client_id >= MAX_CLIENTS)
@@ -647,7 +730,8 @@ bool PlayerManager_GetLocalPlayerState(PlayerManager pm, Msg_PlayerStateData *ou
     out_data->message_type = MSG_TYPE_C_PLAYER_STATE; // Set message type for server identification.
     out_data->client_id = (uint8_t)pm->local_player_client_id;
     out_data->position = p->position;
-    out_data->sprite_portion = p->sprite_portion;
+    out_data->anim_row = (uint8_t)(p->sprite_portion.y / PLAYER_SPRITE_FRAME_HEIGHT);
+    out_data->anim_frame = (uint8_t)p->current_frame;
     out_data->flip_mode = p->flip_mode;
     out_data->team = p->team;
     out_data->current_health = p->current_health;
@@ -655,6 +739,130 @@ bool PlayerManager_GetLocalPlayerState(PlayerManager pm, Msg_PlayerStateData *ou
     return true;
 }
 
+SDL_FPoint Player_GetSpawnPosition(bool team)
+{
+    return team ? (SDL_FPoint){BASE_RED_POS_X + 300, BUILDINGS_POS_Y} : (SDL_FPoint){BASE_BLUE_POS_X - 300, BUILDINGS_POS_Y};
+}
+
+void Player_ApplyInput(AppState *state, SDL_FPoint *position, bool team, Uint8 buttons, float delta_time)
+{
+    if (!state || !position)
+        return;
+
+    if (buttons & PLAYER_INPUT_SPAWN)
+    {
+        *position = Player_GetSpawnPosition(team);
+    }
+
+    float move_x = 0.0f;
+    float move_y = 0.0f;
+    if (buttons & PLAYER_INPUT_UP)
+        move_y -= 1.0f;
+    if (buttons & PLAYER_INPUT_DOWN)
+        move_y += 1.0f;
+    if (buttons & PLAYER_INPUT_LEFT)
+        move_x -= 1.0f;
+    if (buttons & PLAYER_INPUT_RIGHT)
+        move_x += 1.0f;
+
+    // --- Normalize and Apply Movement ---
+    float len_sq = move_x * move_x + move_y * move_y;
+    // Normalize the movement vector only if there is input, prevents division by zero
+    // and ensures consistent speed regardless of direction (diagonal vs cardinal).
+    if (len_sq > 0.001f)
+    {
+        float len = sqrtf(len_sq);
+        move_x = (move_x / len) * PLAYER_SPEED * delta_time;
+        move_y = (move_y / len) * PLAYER_SPEED * delta_time;
+    }
+
+    // Create Rect of the player
+    SDL_FRect player_bounds = {
+        move_x - PLAYER_WIDTH / 2.0f + position->x,
+        move_y - PLAYER_HEIGHT / 2.0f + position->y,
+        PLAYER_WIDTH,
+        PLAYER_HEIGHT};
+
+    bool collision = false;
+
+    for (int i = 0; state->tower_manager && i < MAX_TOTAL_TOWERS; i++)
+    {
+        if (SDL_HasRectIntersectionFloat(&player_bounds, &state->tower_manager->towers[i].rect))
+        {
+            collision = true;
+        }
+    }
+
+    for (int i = 0; state->base_manager && i < MAX_BASES; i++)
+    {
+        if (SDL_HasRectIntersectionFloat(&player_bounds, &state->base_manager->bases[i].rect))
+        {
+            collision = true;
+        }
+    }
+
+    if (!collision) // If player doesn't intersect, update position
+    {
+        position->x += move_x;
+        position->y += move_y;
+    }
+
+    // --- Clamp Position ---
+    if (state->map_state)
+    {
+        // Prevent player from moving outside the map horizontally.
+        position->x = fmaxf(PLAYER_WIDTH / 2.0f, fminf(position->x, Map_GetWidthPixels(state->map_state) - PLAYER_WIDTH / 2.0f));
+        // Prevent player from moving outside the map vertically.
+        position->y = fmaxf(CLIFF_BOUNDARY, fminf(position->y, WATER_BOUNDARY));
+    }
+}
+
+int PlayerManager_GetPendingInputs(PlayerManager pm, PlayerInputCommand *out, int max_count)
+{
+    if (!pm || !out || max_count <= 0)
+        return 0;
+
+    int pending = (Uint16)(pm->next_input_seq - pm->acked_input_seq - 1);
+    int count = SDL_min(pending, max_count);
+    Uint16 first_seq = (Uint16)(pm->next_input_seq - count);
+    for (int i = 0; i < count; ++i)
+    {
+        out[i] = pm->input_history[(Uint16)(first_seq + i) % PLAYER_INPUT_HISTORY];
+    }
+    return count;
+}
+
+void PlayerManager_ReconcileLocalPlayer(AppState *state, Uint16 acked_seq, SDL_FPoint server_position)
+{
+    PlayerManager pm = state ? state->player_manager : NULL;
+    if (!pm || pm->local_player_client_id < 0)
+        return;
+
+    // Only newer acks for commands this client actually produced
+    Uint16 newest_seq = (Uint16)(pm->next_input_seq - 1);
+    if (!NetDelta_SeqNewer(acked_seq, pm->acked_input_seq) || NetDelta_SeqNewer(acked_seq, newest_seq))
+        return;
+    pm->acked_input_seq = acked_seq;
+
+    // Start from the server's result and replay what it has not seen yet
+    PlayerInstance *p = &pm->players[pm->local_player_client_id];
+    SDL_FPoint predicted = p->position;
+    p->position = server_position;
+    for (Uint16 seq = (Uint16)(acked_seq + 1); seq != pm->next_input_seq; ++seq)
+    {
+        const PlayerInputCommand *command = &pm->input_history[seq % PLAYER_INPUT_HISTORY];
+        Player_ApplyInput(state, &p->position, p->team, command->buttons, state->delta_time);
+    }
+    update_player_rect(p);
+
+    float error_x = p->position.x - predicted.x;
+    float error_y = p->position.y - predicted.y;
+    if (error_x * error_x + error_y * error_y > 1.0f)
+    {
+        SDL_LogDebug(SDL_LOG_CATEGORY_APPLICATION, "Local player corrected by (%.1f, %.1f) after input %u.", error_x, error_y, (unsigned int)acked_seq);
+    }
+}
+
 void damagePlayer(AppState state, int playerIndex, float damageValue, bool sendToServer)
 {
     PlayerInstance *p = &state.player_manager->players[playerIndex];
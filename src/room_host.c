@@ -0,0 +1,433 @@
+#include "../include/room_host.h"
+#include "../include/map.h"
+#include "../include/base.h"
+#include "../include/tower.h"
+#include "../include/attack.h"
+#include "../include/player.h"
+#include "../include/minion.h"
+#include "../include/spatial_hash.h"
+#include "../include/net_server.h"
+#include "../include/net_frame.h"
+#include "../include/update.h"
+
+// --- Internal Structures ---
+
+/**
+ * @brief A connection that has not said which room it wants yet.
+ */
+typedef struct PendingConnection
+{
+    SDLNet_StreamSocket *socket; /**< The connection, or NULL if the slot is free. */
+    NetRecvBuffer recv_buffer;   /**< Accumulates bytes until the C_HELLO frame is complete. */
+    Uint64 accept_time;          /**< When the connection was accepted, for the hello timeout. */
+} PendingConnection;
+
+/**
+ * @brief Internal state for the RoomHost module.
+ */
+struct RoomHost_s
+{
+    SDLNet_Server *listen_socket;      /**< Listens on SERVER_PORT for every room. */
+    SDLNet_DatagramSocket *udp_socket; /**< Datagram socket on SERVER_PORT shared by every room, or NULL (TCP only). */
+    PendingConnection *pending;        /**< Connections waiting for C_HELLO (ROOM_PENDING_MAX entries). */
+    AppState **rooms;                  /**< One AppState per room, indexed by room id; NULL while a room could not be created. */
+    Uint64 *retry_time;                /**< Per room, when to try creating it again while it is NULL. */
+    Uint32 *retry_delay_ms;            /**< Per room, current wait between attempts; 0 once the room exists. */
+    int room_count;                    /**< Number of rooms. */
+};
+
+// --- Static Helper Functions ---
+
+/**
+ * @brief Frees a room's modules and its AppState.
+ * Works on a partially created room as well.
+ * @param room The room's AppState (may be NULL).
+ */
+static void destroy_room(AppState *room)
+{
+    if (!room)
+        return;
+
+    // These cleanup callbacks only forget the pointer, so the containers are freed here first (as in SDL_AppQuit)
+    PlayerManager_Destroy(room->player_manager);
+    room->player_manager = NULL;
+    AttackManager_Destroy(room->attack_manager);
+    room->attack_manager = NULL;
+    TowerManager_Destroy(room->tower_manager);
+    room->tower_manager = NULL;
+    BaseManager_Destroy(room->base_manager);
+    room->base_manager = NULL;
+    NetServer_Destroy(room->net_server_state);
+    room->net_server_state = NULL;
+
+    // The map's cleanup callback releases its contents but not the container
+    MapState map_state = room->map_state;
+    EntityManager_Destroy(room->entity_manager, room);
+    Map_Destroy(map_state);
+
+    SDL_free(room);
+}
+
+/**
+ * @brief Creates a room: a headless AppState running the same modules as a dedicated server.
+ * @param host_state The process's AppState, whose limits the room takes.
+ * @param room_id Id of the room.
+ * @param udp_socket The shared datagram socket (may be NULL).
+ * @return The room's AppState, or NULL on failure.
+ */
+static AppState *create_room(const AppState *host_state, Uint16 room_id, SDLNet_DatagramSocket *udp_socket)
+{
+    AppState *room = (AppState *)SDL_calloc(1, sizeof(AppState));
+    if (!room)
+    {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    room->is_server = true;
+    room->is_dedicated = true;
+    room->room_id = room_id;
+    room->max_players = host_state->max_players;
+    room->dedicated_start_players = host_state->dedicated_start_players;
+    room->max_minions = host_state->max_minions;
+    room->max_attacks = host_state->max_attacks;
+    room->interpolation_delay_ms = host_state->interpolation_delay_ms;
+    room->delta_time = 1.0f / SIM_TICK_RATE;
+
+    // Same modules in the same order as a dedicated server in SDL_AppInit; each step runs only if the previous one succeeded
+    room->entity_manager = EntityManager_Create(MAX_MANAGED_ENTITIES);
+    if (room->entity_manager)
+        room->net_server_state = NetServer_InitRoom(room, room_id, udp_socket);
+    if (room->net_server_state)
+        room->map_state = Map_Init(room);
+    if (room->map_state)
+        room->spatial_hash = SpatialHash_Init(room);
+    if (room->spatial_hash)
+        room->base_manager = BaseManager_Init(room);
+    if (room->base_manager)
+        room->tower_manager = TowerManager_Init(room);
+    if (room->tower_manager)
+        room->attack_manager = AttackManager_Init(room);
+    if (room->attack_manager)
+        room->player_manager = PlayerManager_Init(room);
+    if (room->player_manager)
+        room->minion_manager = MinionManager_Init(room);
+    if (!room->minion_manager)
+    {
+        SDL_LogError(SDL_LOG_CATEGORY_ERROR, "[RoomHost] Failed to create room %u: %s", (unsigned int)room_id, SDL_GetError());
+        destroy_room(room);
+        return NULL;
+    }
+
+    room->currentGameState = GAME_STATE_LOBBY;
+    return room;
+}
+
+/**
+ * @brief Creates room room_id into its slot, or schedules the next attempt with a doubling backoff.
+ * @param host The RoomHost instance.
+ * @param host_state The process's AppState, whose limits the room takes.
+ * @param room_id Id of the room, whose slot is NULL.
+ * @return True if the room now exists.
+ */
+static bool open_room(RoomHost host, const AppState *host_state, int room_id)
+{
+    host->rooms[room_id] = create_room(host_state, (Uint16)room_id, host->udp_socket);
+    if (host->rooms[room_id])
+    {
+        host->retry_delay_ms[room_id] = 0;
+        return true;
+    }
+
+    Uint32 delay = host->retry_delay_ms[room_id];
+    delay = delay ? SDL_min(delay * 2, ROOM_RETRY_MAX_MS) : ROOM_RETRY_MIN_MS;
+    host->retry_delay_ms[room_id] = delay;
+    host->retry_time[room_id] = SDL_GetTicks() + delay;
+    SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[RoomHost] Room %d unavailable, trying again in %u ms.", room_id, (unsigned int)delay);
+    return false;
+}
+
+/**
+ * @brief Closes a pending connection and frees its slot.
+ * @param pending The pending connection.
+ */
+static void close_pending(PendingConnection *pending)
+{
+    SDLNet_DestroyStreamSocket(pending->socket);
+    pending->socket = NULL;
+}
+
+/**
+ * @brief Accepts every new connection into a free pending slot.
+ * @param host The RoomHost instance.
+ */
+static void accept_connections(RoomHost host)
+{
+    SDLNet_StreamSocket *socket = NULL;
+    while (SDLNet_AcceptClient(host->listen_socket, &socket) && socket)
+    {
+        PendingConnection *slot = NULL;
+        for (int i = 0; i < ROOM_PENDING_MAX && !slot; ++i)
+        {
+            if (!host->pending[i].socket)
+                slot = &host->pending[i];
+        }
+        if (!slot)
+        {
+            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[RoomHost] Too many connections waiting for C_HELLO, rejecting a new one.");
+            SDLNet_DestroyStreamSocket(socket);
+        }
+        else
+        {
+            slot->socket = socket;
+            slot->accept_time = SDL_GetTicks();
+            NetFrame_ResetRecvBuffer(&slot->recv_buffer);
+        }
+        socket = NULL;
+    }
+}
+
+/**
+ * @brief Reads the C_HELLO of pending connections and hands each to the room it names.
+ * Clients send nothing before S_WELCOME except C_HELLO, so no bytes are left behind in the pending buffer.
+ * @param host The RoomHost instance.
+ */
+static void route_pending_connections(RoomHost host)
+{
+    char payload[NET_FRAME_MAX_PAYLOAD];
+    Uint64 now = SDL_GetTicks();
+
+    for (int i = 0; i < ROOM_PENDING_MAX; ++i)
+    {
+        PendingConnection *pending = &host->pending[i];
+        if (!pending->socket)
+            continue;
+
+        int frame_length = -1;
+        if (NetFrame_ReadFromSocket(&pending->recv_buffer, pending->socket) >= 0)
+            frame_length = NetFrame_PopFrame(&pending->recv_buffer, payload, sizeof(payload));
+        if (frame_length == 0)
+        {
+            if (now > pending->accept_time + ROOM_HELLO_TIMEOUT_MS)
+            {
+                SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[RoomHost] No C_HELLO within %d ms, closing connection.", ROOM_HELLO_TIMEOUT_MS);
+                close_pending(pending);
+            }
+            continue;
+        }
+
+        Msg_HelloData hello;
+        if (frame_length <= 0 || !NetCodec_DecodeHello(payload, frame_length, &hello) ||
+            hello.message_type != MSG_TYPE_C_HELLO || hello.room_id >= host->room_count)
+        {
+            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[RoomHost] Closing connection without a valid C_HELLO for one of %d room(s).", host->room_count);
+            close_pending(pending);
+            continue;
+        }
+        AppState *room = host->rooms[hello.room_id];
+        if (!room)
+        {
+            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[RoomHost] Room %u unavailable, closing connection.", (unsigned int)hello.room_id);
+            close_pending(pending);
+            continue;
+        }
+
+        if (NetServer_AdoptClient(room->net_server_state, pending->socket, payload, frame_length, room))
+        {
+            pending->socket = NULL; // Owned by the room now
+        }
+        else
+        {
+            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[RoomHost] Rejecting connection: %s", SDL_GetError());
+            close_pending(pending);
+        }
+    }
+}
+
+/**
+ * @brief Hands every pending datagram to the room whose client sent it.
+ * @param host The RoomHost instance.
+ */
+static void route_datagrams(RoomHost host)
+{
+    if (!host->udp_socket)
+        return;
+
+    SDLNet_Datagram *datagram = NULL;
+    while (SDLNet_ReceiveDatagram(host->udp_socket, &datagram) && datagram)
+    {
+        bool handled = false;
+        for (int i = 0; i < host->room_count && !handled; ++i)
+        {
+            if (host->rooms[i])
+                handled = NetServer_HandleDatagram(host->rooms[i]->net_server_state, datagram, host->rooms[i]);
+        }
+        if (!handled && datagram->buflen > 0 && datagram->buf[0] == MSG_TYPE_C_UDP_HELLO)
+        {
+            SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[RoomHost] Ignoring C_UDP_HELLO that matches no room's client.");
+        }
+        SDLNet_DestroyDatagram(datagram);
+        datagram = NULL;
+    }
+}
+
+// --- Static Callback Functions (for EntityManager) ---
+
+/**
+ * @brief Wrapper function conforming to EntityFunctions.update signature.
+ * Routes new connections and datagrams, then advances every room by one tick. A room whose
+ * dedicated session ended (match over, no clients left) is replaced by a fresh one; a room that
+ * could not be created is tried again once its backoff has passed.
+ * @param manager The EntityManager instance (unused).
+ * @param state Pointer to the process's AppState.
+ */
+static void room_host_update_callback(EntityManager manager, AppState *state)
+{
+    (void)manager;
+    RoomHost host = state ? state->room_host : NULL;
+    if (!host)
+        return;
+
+    accept_connections(host);
+    route_pending_connections(host);
+    route_datagrams(host);
+
+    Uint64 now = SDL_GetTicks();
+    for (int i = 0; i < host->room_count; ++i)
+    {
+        AppState *room = host->rooms[i];
+        if (!room)
+        {
+            if (now >= host->retry_time[i] && open_room(host, state, i))
+            {
+                SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[RoomHost] Room %d is available again.", i);
+            }
+            continue;
+        }
+
+        app_tick(room);
+        if (room->quit_requested)
+        {
+            SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[RoomHost] Room %d finished, opening a new match in it.", i);
+            destroy_room(room);
+            host->rooms[i] = NULL;
+            open_room(host, state, i);
+        }
+    }
+}
+
+/**
+ * @brief Wrapper function conforming to EntityFunctions.cleanup signature.
+ * @param manager The EntityManager instance (unused).
+ * @param state Pointer to the process's AppState.
+ */
+static void room_host_cleanup_callback(EntityManager manager, AppState *state)
+{
+    (void)manager;
+    if (!state || !state->room_host)
+        return;
+
+    RoomHost_Destroy(state->room_host);
+    state->room_host = NULL;
+}
+
+// --- Public API Function Implementations ---
+
+RoomHost RoomHost_Init(AppState *state)
+{
+    if (!state || !state->entity_manager)
+    {
+        SDL_SetError("Invalid AppState or missing entity_manager for RoomHost_Init");
+        return NULL;
+    }
+
+    RoomHost host = (RoomHost)SDL_calloc(1, sizeof(struct RoomHost_s));
+    if (!host)
+    {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    host->room_count = CLAMP(state->room_count, 1, ROOM_MAX_COUNT);
+    host->pending = (PendingConnection *)SDL_calloc(ROOM_PENDING_MAX, sizeof(PendingConnection));
+    host->rooms = (AppState **)SDL_calloc((size_t)host->room_count, sizeof(AppState *));
+    host->retry_time = (Uint64 *)SDL_calloc((size_t)host->room_count, sizeof(Uint64));
+    host->retry_delay_ms = (Uint32 *)SDL_calloc((size_t)host->room_count, sizeof(Uint32));
+    if (!host->pending || !host->rooms || !host->retry_time || !host->retry_delay_ms)
+    {
+        SDL_OutOfMemory();
+        RoomHost_Destroy(host);
+        return NULL;
+    }
+
+    host->listen_socket = SDLNet_CreateServer(NULL, SERVER_PORT);
+    if (!host->listen_socket)
+    {
+        SDL_LogError(SDL_LOG_CATEGORY_ERROR, "[RoomHost Init] SDLNet_CreateServer failed: %s", SDL_GetError());
+        RoomHost_Destroy(host);
+        return NULL;
+    }
+    host->udp_socket = SDLNet_CreateDatagramSocket(NULL, SERVER_PORT);
+    if (!host->udp_socket)
+    {
+        SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "[RoomHost Init] SDLNet_CreateDatagramSocket failed: %s. Player state will use TCP only.", SDL_GetError());
+    }
+
+    for (int i = 0; i < host->room_count; ++i)
+    {
+        host->rooms[i] = create_room(state, (Uint16)i, host->udp_socket);
+        if (!host->rooms[i])
+        {
+            RoomHost_Destroy(host);
+            return NULL;
+        }
+    }
+
+    EntityFunctions room_host_funcs = {
+        .name = "room_host",
+        .update = room_host_update_callback,
+        .cleanup = room_host_cleanup_callback,
+        .render = NULL,
+        .handle_events = NULL};
+
+    if (!EntityManager_Add(state->entity_manager, &room_host_funcs))
+    {
+        SDL_LogError(SDL_LOG_CATEGORY_ERROR, "[RoomHost Init] Failed to add entity to manager: %s", SDL_GetError());
+        RoomHost_Destroy(host);
+        return NULL;
+    }
+
+    SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "[RoomHost] Hosting %d room(s) on port %d.", host->room_count, SERVER_PORT);
+    return host;
+}
+
+void RoomHost_Destroy(RoomHost host)
+{
+    if (!host)
+        return;
+
+    if (host->rooms)
+    {
+        for (int i = 0; i < host->room_count; ++i)
+        {
+            destroy_room(host->rooms[i]);
+        }
+    }
+    if (host->pending)
+    {
+        for (int i = 0; i < ROOM_PENDING_MAX; ++i)
+        {
+            if (host->pending[i].socket)
+                close_pending(&host->pending[i]);
+        }
+    }
+    if (host->udp_socket)
+        SDLNet_DestroyDatagramSocket(host->udp_socket);
+    if (host->listen_socket)
+        SDLNet_DestroyServer(host->listen_socket);
+
+    SDL_free(host->rooms);
+    SDL_free(host->retry_time);
+    SDL_free(host->retry_delay_ms);
+    SDL_free(host->pending);
+    SDL_free(host);
+    SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "RoomHost destroyed.");
+}
@@ -0,0 +1,403 @@
+#include "../include/spatial_hash.h"
+#include "../include/tower.h"
+
+// --- Internal Structures ---
+
+/**
+ * @brief One object stored in the grid.
+ */
+typedef struct SpatialItem
+{
+    SDL_FRect bounds; /**< World-space box covering every shape the collision code tests for this object. */
+    SpatialKind kind; /**< What the object is. */
+    int index;        /**< Index in the owning manager's array. */
+    Uint32 stamp;     /**< Last query that returned the item, so objects spanning several cells are reported once. */
+} SpatialItem;
+
+/**
+ * @brief Link from a bucket to an item; an item gets one per cell it overlaps.
+ */
+typedef struct SpatialCellRef
+{
+    int item; /**< Index into items. */
+    int next; /**< Next ref in the same bucket, or -1. */
+} SpatialCellRef;
+
+/**
+ * @brief Internal state for the SpatialHash module.
+ */
+struct SpatialHash_s
+{
+    SpatialItem *items;                    /**< Objects inserted this tick. */
+    SpatialHit *hits;                      /**< Result buffer returned by the queries, as large as items. */
+    int item_count;                        /**< Number of items in use. */
+    int item_capacity;                     /**< Allocated number of items and hits; follows the minion pool. */
+    int bucket_head[SPATIAL_HASH_BUCKETS]; /**< First ref of each bucket, or -1. */
+    SpatialCellRef *refs;                  /**< Bucket chains, grown as needed and reused every tick. */
+    int ref_count;                         /**< Number of refs in use. */
+    int ref_capacity;                      /**< Allocated number of refs. */
+    Uint32 query_stamp;                    /**< Incremented by every query. */
+};
+
+/**
+ * @brief Inclusive range of cells covered by a rectangle.
+ */
+typedef struct CellRange
+{
+    int x0, y0, x1, y1;
+} CellRange;
+
+// --- Static Helper Functions ---
+
+/**
+ * @brief Computes the cells a rectangle touches.
+ * @param rect World-space rectangle.
+ * @return The covered cell range.
+ */
+static CellRange cells_for_rect(const SDL_FRect *rect)
+{
+    CellRange range;
+    range.x0 = (int)floorf(rect->x / SPATIAL_HASH_CELL_SIZE);
+    range.y0 = (int)floorf(rect->y / SPATIAL_HASH_CELL_SIZE);
+    range.x1 = (int)floorf((rect->x + rect->w) / SPATIAL_HASH_CELL_SIZE);
+    range.y1 = (int)floorf((rect->y + rect->h) / SPATIAL_HASH_CELL_SIZE);
+    return range;
+}
+
+/**
+ * @brief Maps a cell to its bucket.
+ * @param cx Cell column.
+ * @param cy Cell row.
+ * @return The bucket index.
+ */
+static int bucket_for_cell(int cx, int cy)
+{
+    Uint32 hash = ((Uint32)cx * 73856093u) ^ ((Uint32)cy * 19349663u);
+    return (int)(hash & (SPATIAL_HASH_BUCKETS - 1));
+}
+
+/**
+ * @brief Tells whether two rectangles overlap, touching edges included.
+ * Unlike SDL_HasRectIntersectionFloat this also accepts zero-size rects, which point queries use.
+ * @param a First rectangle.
+ * @param b Second rectangle.
+ * @return True if they overlap.
+ */
+static bool rects_touch(const SDL_FRect *a, const SDL_FRect *b)
+{
+    return a->x <= b->x + b->w && b->x <= a->x + a->w &&
+           a->y <= b->y + b->h && b->y <= a->y + a->h;
+}
+
+/**
+ * @brief Adds an object to the grid, linking it into every cell its bounds cover.
+ * @param grid The SpatialHash instance.
+ * @param kind What the object is.
+ * @param index Its index in the owning manager's array.
+ * @param bounds Its world-space bounds.
+ */
+static void insert_item(SpatialHash grid, SpatialKind kind, int index, SDL_FRect bounds)
+{
+    if (grid->item_count >= grid->item_capacity)
+        return;
+
+    CellRange range = cells_for_rect(&bounds);
+    int cell_count = (range.x1 - range.x0 + 1) * (range.y1 - range.y0 + 1);
+    if (grid->ref_count + cell_count > grid->ref_capacity)
+    {
+        int new_capacity = SDL_max(grid->ref_capacity * 2, grid->ref_count + cell_count);
+        SpatialCellRef *refs = (SpatialCellRef *)SDL_realloc(grid->refs, (size_t)new_capacity * sizeof(SpatialCellRef));
+        if (!refs)
+        {
+            SDL_LogError(SDL_LOG_CATEGORY_ERROR, "[SpatialHash] Out of memory, object left out of the grid.");
+            return;
+        }
+        grid->refs = refs;
+        grid->ref_capacity = new_capacity;
+    }
+
+    int item = grid->item_count++;
+    grid->items[item] = (SpatialItem){.bounds = bounds, .kind = kind, .index = index, .stamp = grid->query_stamp};
+
+    for (int cy = range.y0; cy <= range.y1; ++cy)
+    {
+        for (int cx = range.x0; cx <= range.x1; ++cx)
+        {
+            int bucket = bucket_for_cell(cx, cy);
+            SpatialCellRef *ref = &grid->refs[grid->ref_count];
+            ref->item = item;
+            ref->next = grid->bucket_head[bucket];
+            grid->bucket_head[bucket] = grid->ref_count++;
+        }
+    }
+}
+
+/**
+ * @brief Refills the grid from the current state of every manager.
+ * @param grid The SpatialHash instance.
+ * @param state Pointer to the main AppState.
+ */
+static void rebuild(SpatialHash grid, AppState *state)
+{
+    int needed = MAX_TOTAL_TOWERS + MAX_BASES + MAX_CLIENTS + (state->minion_manager ? state->minion_manager->minion_capacity : 0);
+    if (needed > grid->item_capacity)
+    {
+        SpatialItem *items = (SpatialItem *)SDL_realloc(grid->items, (size_t)needed * sizeof(SpatialItem));
+        if (items)
+            grid->items = items;
+        SpatialHit *hits = (SpatialHit *)SDL_realloc(grid->hits, (size_t)needed * sizeof(SpatialHit));
+        if (hits)
+            grid->hits = hits;
+        if (items && hits)
+            grid->item_capacity = needed;
+        else
+            SDL_LogError(SDL_LOG_CATEGORY_ERROR, "[SpatialHash] Out of memory, grid limited to %d objects.", grid->item_capacity);
+    }
+
+    grid->item_count = 0;
+    grid->ref_count = 0;
+    for (int i = 0; i < SPATIAL_HASH_BUCKETS; ++i)
+        grid->bucket_head[i] = -1;
+
+    if (state->tower_manager)
+    {
+        for (int i = 0; i < MAX_TOTAL_TOWERS; ++i)
+            insert_item(grid, SPATIAL_KIND_TOWER, i, state->tower_manager->towers[i].rect);
+    }
+
+    if (state->base_manager)
+    {
+        for (int i = 0; i < MAX_BASES; ++i)
+            insert_item(grid, SPATIAL_KIND_BASE, i, state->base_manager->bases[i].rect);
+    }
+
+    if (state->minion_manager)
+    {
+        for (int i = 0; i < state->minion_manager->minion_capacity; ++i)
+        {
+            const MinionData *minion = &state->minion_manager->minions[i];
+            if (!minion->active)
+                continue;
+
+            // Movement tests a box centered on the position and attacks one anchored at it; cover both
+            SDL_FRect bounds = {minion->position.x - MINION_WIDTH / 2.0f, minion->position.y - MINION_HEIGHT / 2.0f,
+                                MINION_WIDTH * 1.5f, MINION_HEIGHT * 1.5f};
+            insert_item(grid, SPATIAL_KIND_MINION, i, bounds);
+        }
+    }
+
+    if (state->player_manager)
+    {
+        for (int i = 0; i < MAX_CLIENTS; ++i)
+        {
+            const PlayerInstance *player = &state->player_manager->players[i];
+            if (!player->active)
+                continue;
+
+            // Targeting uses the position and hits use the rect, so the bounds span both
+            float min_x = SDL_min(player->rect.x, player->position.x);
+            float min_y = SDL_min(player->rect.y, player->position.y);
+            float max_x = SDL_max(player->rect.x + player->rect.w, player->position.x);
+            float max_y = SDL_max(player->rect.y + player->rect.h, player->position.y);
+            insert_item(grid, SPATIAL_KIND_PLAYER, i, (SDL_FRect){min_x, min_y, max_x - min_x, max_y - min_y});
+        }
+    }
+}
+
+/**
+ * @brief Parameters and results of the query in progress.
+ */
+typedef struct SpatialQuery
+{
+    SDL_FRect area;    /**< Query rectangle. */
+    Uint32 kinds;      /**< Mask of SpatialKind values to return. */
+    bool use_radius;   /**< Whether results must also come within radius of center. */
+    SDL_FPoint center; /**< Center of the radius test. */
+    float radius_sq;   /**< Squared radius. */
+    Uint32 stamp;      /**< Stamp marking items already considered. */
+    int count;         /**< Results collected so far. */
+} SpatialQuery;
+
+/**
+ * @brief Tests one item against the query and adds it to the results, kept sorted by kind then index.
+ * @param grid The SpatialHash instance.
+ * @param q The query in progress.
+ * @param item The candidate item.
+ */
+static void consider_item(SpatialHash grid, SpatialQuery *q, SpatialItem *item)
+{
+    if (item->stamp == q->stamp || !(item->kind & q->kinds))
+        return;
+    item->stamp = q->stamp;
+
+    if (!rects_touch(&q->area, &item->bounds))
+        return;
+    if (q->use_radius)
+    {
+        float nearest_x = SDL_clamp(q->center.x, item->bounds.x, item->bounds.x + item->bounds.w);
+        float nearest_y = SDL_clamp(q->center.y, item->bounds.y, item->bounds.y + item->bounds.h);
+        float dx = nearest_x - q->center.x;
+        float dy = nearest_y - q->center.y;
+        if (dx * dx + dy * dy > q->radius_sq)
+            return;
+    }
+
+    // Insertion sort; a query returns a handful of objects at most
+    SpatialHit hit = {item->kind, item->index};
+    int pos = q->count++;
+    while (pos > 0 && (grid->hits[pos - 1].kind > hit.kind ||
+                       (grid->hits[pos - 1].kind == hit.kind && grid->hits[pos - 1].index > hit.index)))
+    {
+        grid->hits[pos] = grid->hits[pos - 1];
+        pos--;
+    }
+    grid->hits[pos] = hit;
+}
+
+/**
+ * @brief Collects the items matching a query from the cells its area covers.
+ * @param grid The SpatialHash instance.
+ * @param q The query; count is filled in.
+ * @return The sorted results, or NULL if there are none.
+ */
+static const SpatialHit *run_query(SpatialHash grid, SpatialQuery *q)
+{
+    q->stamp = ++grid->query_stamp;
+    q->count = 0;
+
+    CellRange range = cells_for_rect(&q->area);
+    Sint64 cell_count = (Sint64)(range.x1 - range.x0 + 1) * (range.y1 - range.y0 + 1);
+    if (cell_count > SPATIAL_HASH_BUCKETS)
+    {
+        // An area wider than the table would visit the same buckets repeatedly, so walk the items instead
+        for (int i = 0; i < grid->item_count; ++i)
+            consider_item(grid, q, &grid->items[i]);
+    }
+    else
+    {
+        for (int cy = range.y0; cy <= range.y1; ++cy)
+        {
+            for (int cx = range.x0; cx <= range.x1; ++cx)
+            {
+                for (int ref = grid->bucket_head[bucket_for_cell(cx, cy)]; ref != -1; ref = grid->refs[ref].next)
+                    consider_item(grid, q, &grid->items[grid->refs[ref].item]);
+            }
+        }
+    }
+
+    return q->count ? grid->hits : NULL;
+}
+
+// --- Static Callback Functions (for EntityManager) ---
+
+/**
+ * @brief Wrapper function conforming to EntityFunctions.update signature.
+ * Rebuilds the grid at the start of the tick, before the modules that query it move anything.
+ * @param manager The EntityManager instance (unused).
+ * @param state Pointer to the main AppState.
+ */
+static void spatial_hash_update_callback(EntityManager manager, AppState *state)
+{
+    (void)manager;
+    if (!state || !state->spatial_hash)
+        return;
+
+    rebuild(state->spatial_hash, state);
+}
+
+/**
+ * @brief Wrapper function conforming to EntityFunctions.cleanup signature.
+ * @param manager The EntityManager instance (unused).
+ * @param state Pointer to the main AppState.
+ */
+static void spatial_hash_cleanup_callback(EntityManager manager, AppState *state)
+{
+    (void)manager;
+    if (!state || !state->spatial_hash)
+        return;
+
+    SpatialHash_Destroy(state->spatial_hash);
+    state->spatial_hash = NULL;
+}
+
+// --- Public API Function Implementations ---
+
+SpatialHash SpatialHash_Init(AppState *state)
+{
+    if (!state || !state->entity_manager)
+    {
+        SDL_SetError("Invalid AppState or missing entity_manager for SpatialHash_Init");
+        return NULL;
+    }
+
+    SpatialHash grid = (SpatialHash)SDL_calloc(1, sizeof(struct SpatialHash_s));
+    if (!grid)
+    {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    for (int i = 0; i < SPATIAL_HASH_BUCKETS; ++i)
+        grid->bucket_head[i] = -1;
+
+    EntityFunctions grid_funcs = {
+        .name = "spatial_hash",
+        .update = spatial_hash_update_callback,
+        .cleanup = spatial_hash_cleanup_callback,
+        .render = NULL,
+        .handle_events = NULL};
+
+    if (!EntityManager_Add(state->entity_manager, &grid_funcs))
+    {
+        SDL_LogError(SDL_LOG_CATEGORY_ERROR, "[SpatialHash Init] Failed to add entity to manager: %s", SDL_GetError());
+        SDL_free(grid);
+        return NULL;
+    }
+
+    SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "SpatialHash initialized and entity registered.");
+    return grid;
+}
+
+void SpatialHash_Destroy(SpatialHash grid)
+{
+    if (!grid)
+        return;
+
+    SDL_free(grid->items);
+    SDL_free(grid->hits);
+    SDL_free(grid->refs);
+    SDL_free(grid);
+    SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "SpatialHash destroyed.");
+}
+
+const SpatialHit *SpatialHash_QueryRect(SpatialHash grid, const SDL_FRect *rect, Uint32 kinds, int *out_count)
+{
+    if (!out_count)
+        return NULL;
+    *out_count = 0;
+    if (!grid || !rect)
+        return NULL;
+
+    SpatialQuery q = {.area = *rect, .kinds = kinds, .use_radius = false};
+    const SpatialHit *hits = run_query(grid, &q);
+    *out_count = q.count;
+    return hits;
+}
+
+const SpatialHit *SpatialHash_QueryRange(SpatialHash grid, SDL_FPoint center, float radius, Uint32 kinds, int *out_count)
+{
+    if (!out_count)
+        return NULL;
+    *out_count = 0;
+    if (!grid || radius < 0.0f)
+        return NULL;
+
+    SpatialQuery q = {
+        .area = {center.x - radius, center.y - radius, radius * 2.0f, radius * 2.0f},
+        .kinds = kinds,
+        .use_radius = true,
+        .center = center,
+        .radius_sq = radius * radius};
+    const SpatialHit *hits = run_query(grid, &q);
+    *out_count = q.count;
+    return hits;
+}
@@ -0,0 +1,304 @@
+#include "../include/sprite_batch.h"
+
+// --- Internal Structures ---
+
+/**
+ * @brief One queued quad, already transformed into render coordinates.
+ */
+typedef struct Sprite
+{
+    SDL_Texture *texture; /**< Texture the quad samples. */
+    int depth;            /**< Draw layer (SpriteDepth). */
+    int order;            /**< Submission order, keeps the sort stable within a layer and texture. */
+    SDL_Vertex vertices[4]; /**< Corners in top-left, top-right, bottom-right, bottom-left order. */
+} Sprite;
+
+/**
+ * @brief Internal state for the SpriteBatch module.
+ */
+struct SpriteBatch_s
+{
+    Sprite *sprites;      /**< Sprites queued this frame. */
+    int count;            /**< Number of queued sprites. */
+    int capacity;         /**< Allocated length of sprites. */
+    SDL_Vertex *vertices; /**< Scratch vertex buffer for one submission (4 per sprite). */
+    int *indices;         /**< Scratch index buffer for one submission (6 per sprite). */
+    int scratch_capacity; /**< Number of sprites the scratch buffers can hold. */
+};
+
+// --- Static Helper Functions ---
+
+/**
+ * @brief Orders sprites by depth, then texture, then submission order.
+ * @param a First Sprite.
+ * @param b Second Sprite.
+ * @return Negative, zero or positive as for qsort.
+ */
+static int compare_sprites(const void *a, const void *b)
+{
+    const Sprite *sa = (const Sprite *)a;
+    const Sprite *sb = (const Sprite *)b;
+
+    if (sa->depth != sb->depth)
+        return sa->depth < sb->depth ? -1 : 1;
+    if (sa->texture != sb->texture)
+        return (uintptr_t)sa->texture < (uintptr_t)sb->texture ? -1 : 1;
+    return sa->order - sb->order;
+}
+
+/**
+ * @brief Makes room for at least one more sprite.
+ * @param batch The SpriteBatch instance.
+ * @return True if there is room, false if the buffer could not grow.
+ */
+static bool reserve_sprite(SpriteBatch batch)
+{
+    if (batch->count < batch->capacity)
+        return true;
+
+    int new_capacity = batch->capacity ? batch->capacity * 2 : SPRITE_BATCH_INITIAL_CAPACITY;
+    Sprite *grown = (Sprite *)SDL_realloc(batch->sprites, (size_t)new_capacity * sizeof(Sprite));
+    if (!grown)
+        return false;
+
+    batch->sprites = grown;
+    batch->capacity = new_capacity;
+    return true;
+}
+
+/**
+ * @brief Makes the scratch buffers large enough to submit sprite_count sprites at once.
+ * @param batch The SpriteBatch instance.
+ * @param sprite_count Number of sprites in the largest run.
+ * @return True on success, false if the buffers could not grow.
+ */
+static bool reserve_scratch(SpriteBatch batch, int sprite_count)
+{
+    if (sprite_count <= batch->scratch_capacity)
+        return true;
+
+    SDL_Vertex *vertices = (SDL_Vertex *)SDL_realloc(batch->vertices, (size_t)sprite_count * 4 * sizeof(SDL_Vertex));
+    if (!vertices)
+        return false;
+    batch->vertices = vertices;
+
+    int *indices = (int *)SDL_realloc(batch->indices, (size_t)sprite_count * 6 * sizeof(int));
+    if (!indices)
+        return false;
+    batch->indices = indices;
+
+    batch->scratch_capacity = sprite_count;
+    return true;
+}
+
+// --- Static Callback Functions (for EntityManager) ---
+
+/**
+ * @brief Wrapper function conforming to EntityFunctions.render signature.
+ * Runs after every sprite-drawing entity and submits what they queued.
+ * @param manager The EntityManager instance (unused).
+ * @param state Pointer to the main AppState.
+ */
+static void sprite_batch_render_callback(EntityManager manager, AppState *state)
+{
+    (void)manager;
+    if (!state || !state->sprite_batch || !state->renderer)
+        return;
+
+    SpriteBatch_Flush(state->sprite_batch, state->renderer);
+}
+
+/**
+ * @brief Wrapper function conforming to EntityFunctions.cleanup signature.
+ * @param manager The EntityManager instance (unused).
+ * @param state Pointer to the main AppState.
+ */
+static void sprite_batch_cleanup_callback(EntityManager manager, AppState *state)
+{
+    (void)manager;
+    if (!state || !state->sprite_batch)
+        return;
+
+    SpriteBatch_Destroy(state->sprite_batch);
+    state->sprite_batch = NULL;
+}
+
+// --- Public API Function Implementations ---
+
+SpriteBatch SpriteBatch_Init(AppState *state)
+{
+    if (!state || !state->entity_manager)
+    {
+        SDL_SetError("Invalid AppState or missing entity_manager for SpriteBatch_Init");
+        return NULL;
+    }
+
+    SpriteBatch batch = (SpriteBatch)SDL_calloc(1, sizeof(struct SpriteBatch_s));
+    if (!batch)
+    {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+
+    EntityFunctions batch_funcs = {
+        .name = "sprite_batch",
+        .render = sprite_batch_render_callback,
+        .cleanup = sprite_batch_cleanup_callback,
+        .update = NULL,
+        .handle_events = NULL};
+
+    if (!EntityManager_Add(state->entity_manager, &batch_funcs))
+    {
+        SDL_LogError(SDL_LOG_CATEGORY_ERROR, "[SpriteBatch Init] Failed to add entity to manager: %s", SDL_GetError());
+        SDL_free(batch);
+        return NULL;
+    }
+
+    SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "SpriteBatch initialized and entity registered.");
+    return batch;
+}
+
+void SpriteBatch_Destroy(SpriteBatch batch)
+{
+    if (batch)
+    {
+        SDL_free(batch->sprites);
+        SDL_free(batch->vertices);
+        SDL_free(batch->indices);
+        SDL_free(batch);
+        SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "SpriteBatch container destroyed.");
+    }
+}
+
+void SpriteBatch_Draw(SpriteBatch batch, SDL_Texture *texture, const SDL_FRect *src, const SDL_FRect *dst,
+                      double angle_deg, SDL_FlipMode flip, SpriteDepth depth)
+{
+    if (!batch || !texture || !dst || texture->w <= 0 || texture->h <= 0)
+        return;
+
+    if (!reserve_sprite(batch))
+    {
+        SDL_LogWarn(SDL_LOG_CATEGORY_RENDER, "[SpriteBatch] Out of memory, sprite dropped.");
+        return;
+    }
+
+    Sprite *sprite = &batch->sprites[batch->count];
+    sprite->texture = texture;
+    sprite->depth = depth;
+    sprite->order = batch->count;
+    batch->count++;
+
+    // Texture coordinates are normalized; flipping swaps the opposite edges
+    float u0 = src ? src->x / texture->w : 0.0f;
+    float v0 = src ? src->y / texture->h : 0.0f;
+    float u1 = src ? (src->x + src->w) / texture->w : 1.0f;
+    float v1 = src ? (src->y + src->h) / texture->h : 1.0f;
+    if (flip & SDL_FLIP_HORIZONTAL)
+    {
+        float swap = u0;
+        u0 = u1;
+        u1 = swap;
+    }
+    if (flip & SDL_FLIP_VERTICAL)
+    {
+        float swap = v0;
+        v0 = v1;
+        v1 = swap;
+    }
+
+    // Corner offsets from the quad's center, rotated clockwise in screen space like SDL_RenderTextureRotated
+    float half_w = dst->w / 2.0f;
+    float half_h = dst->h / 2.0f;
+    float center_x = dst->x + half_w;
+    float center_y = dst->y + half_h;
+    float radians = (float)angle_deg * (SDL_PI_F / 180.0f);
+    float c = angle_deg != 0.0 ? cosf(radians) : 1.0f;
+    float s = angle_deg != 0.0 ? sinf(radians) : 0.0f;
+
+    const float corner_x[4] = {-half_w, half_w, half_w, -half_w};
+    const float corner_y[4] = {-half_h, -half_h, half_h, half_h};
+    const float corner_u[4] = {u0, u1, u1, u0};
+    const float corner_v[4] = {v0, v0, v1, v1};
+
+    for (int i = 0; i < 4; ++i)
+    {
+        sprite->vertices[i].position.x = center_x + corner_x[i] * c - corner_y[i] * s;
+        sprite->vertices[i].position.y = center_y + corner_x[i] * s + corner_y[i] * c;
+        sprite->vertices[i].color = (SDL_FColor){1.0f, 1.0f, 1.0f, 1.0f};
+        sprite->vertices[i].tex_coord.x = corner_u[i];
+        sprite->vertices[i].tex_coord.y = corner_v[i];
+    }
+}
+
+void SpriteBatch_DrawRegion(SpriteBatch batch, const AtlasRegion *region, const SDL_FRect *src, const SDL_FRect *dst,
+                            double angle_deg, SDL_FlipMode flip, SpriteDepth depth)
+{
+    if (!region)
+        return;
+
+    // Translate the region-relative source rect onto the atlas page
+    SDL_FRect atlas_src = region->rect;
+    if (src)
+    {
+        // Frames past the edge of a sheet would sample its neighbours on the page; skip them
+        // like SDL_RenderTexture skips a source rect outside the texture
+        if (src->x < 0.0f || src->y < 0.0f || src->x + src->w > region->rect.w || src->y + src->h > region->rect.h)
+            return;
+
+        atlas_src.x += src->x;
+        atlas_src.y += src->y;
+        atlas_src.w = src->w;
+        atlas_src.h = src->h;
+    }
+
+    SpriteBatch_Draw(batch, region->texture, &atlas_src, dst, angle_deg, flip, depth);
+}
+
+void SpriteBatch_Flush(SpriteBatch batch, SDL_Renderer *renderer)
+{
+    if (!batch || !renderer || batch->count == 0)
+        return;
+
+    SDL_qsort(batch->sprites, (size_t)batch->count, sizeof(Sprite), compare_sprites);
+
+    int run_start = 0;
+    while (run_start < batch->count)
+    {
+        // A run is every consecutive sprite with the same depth and texture
+        int run_end = run_start + 1;
+        while (run_end < batch->count &&
+               batch->sprites[run_end].texture == batch->sprites[run_start].texture &&
+               batch->sprites[run_end].depth == batch->sprites[run_start].depth)
+        {
+            run_end++;
+        }
+
+        int run_length = run_end - run_start;
+        if (!reserve_scratch(batch, run_length))
+        {
+            SDL_LogWarn(SDL_LOG_CATEGORY_RENDER, "[SpriteBatch] Out of memory, %d sprites skipped.", run_length);
+            run_start = run_end;
+            continue;
+        }
+
+        for (int i = 0; i < run_length; ++i)
+        {
+            SDL_memcpy(&batch->vertices[i * 4], batch->sprites[run_start + i].vertices, sizeof(SDL_Vertex) * 4);
+
+            int base = i * 4;
+            int *quad = &batch->indices[i * 6];
+            quad[0] = base;
+            quad[1] = base + 1;
+            quad[2] = base + 2;
+            quad[3] = base;
+            quad[4] = base + 2;
+            quad[5] = base + 3;
+        }
+
+        SDL_RenderGeometry(renderer, batch->sprites[run_start].texture,
+                           batch->vertices, run_length * 4, batch->indices, run_length * 6);
+        run_start = run_end;
+    }
+
+    batch->count = 0;
+}
@@ -0,0 +1,326 @@
+#include "../include/texture_atlas.h"
+#include "../include/asset_loader.h"
+
+// --- Static Data ---
+
+/**
+ * @brief Source image of every atlas sprite, indexed by AtlasSpriteId.
+ */
+static const char *const sprite_paths[ATLAS_SPRITE_COUNT] = {
+    [ATLAS_SPRITE_BASE_RED] = "./resources/Sprites/Red_Team/Castle_Red.png",
+    [ATLAS_SPRITE_BASE_BLUE] = "./resources/Sprites/Blue_Team/Castle_Blue.png",
+    [ATLAS_SPRITE_BASE_DESTROYED] = "./resources/Sprites/Castle_Destroyed.png",
+    [ATLAS_SPRITE_TOWER_RED] = "./resources/Sprites/Red_Team/Tower_Red.png",
+    [ATLAS_SPRITE_TOWER_BLUE] = "./resources/Sprites/Blue_Team/Tower_Blue.png",
+    [ATLAS_SPRITE_TOWER_DESTROYED] = "./resources/Sprites/Tower_Destroyed.png",
+    [ATLAS_SPRITE_MINION_RED] = "./resources/Sprites/Red_Team/Warrior_Red.png",
+    [ATLAS_SPRITE_MINION_BLUE] = "./resources/Sprites/Blue_Team/Warrior_Blue.png",
+    [ATLAS_SPRITE_WIZARD_RED] = "./resources/Sprites/Red_Team/Fire_Wizard/Fire_Wizard_Spiresheet.png",
+    [ATLAS_SPRITE_WIZARD_BLUE] = "./resources/Sprites/Blue_Team/Lightning_Wizard/Lightning_Wizard_Spritesheet.png",
+    [ATLAS_SPRITE_FIREBALL] = "./resources/Sprites/Red_Team/Fire_Wizard/Fireball_Charge.png",
+    [ATLAS_SPRITE_LIGHTNING_ARROW] = "./resources/Sprites/Blue_Team/Lightning_Wizard/Lightning_Arrow_Charge.png",
+};
+
+// --- Internal Structures ---
+
+/**
+ * @brief Internal state for the TextureAtlas module.
+ */
+struct TextureAtlas_s
+{
+    SDL_Texture *pages[ATLAS_MAX_PAGES];     /**< Packed atlas textures. */
+    int page_count;                          /**< Number of pages in use. */
+    AtlasRegion regions[ATLAS_SPRITE_COUNT]; /**< Lookup table of sprite sub-rects, indexed by AtlasSpriteId. */
+};
+
+/**
+ * @brief Placement of one sprite while packing.
+ */
+typedef struct AtlasPlacement
+{
+    SDL_Surface *surface; /**< Decoded source image. */
+    int page;             /**< Page the sprite was placed on. */
+    int x, y;             /**< Top-left corner on that page. */
+} AtlasPlacement;
+
+// --- Static Helper Functions ---
+
+/**
+ * @brief Orders sprite ids by descending image height; packing tallest first keeps shelves tight.
+ * @param userdata The AtlasPlacement array the ids index.
+ * @param a First AtlasSpriteId.
+ * @param b Second AtlasSpriteId.
+ * @return Negative, zero or positive as for qsort.
+ */
+static int compare_heights(void *userdata, const void *a, const void *b)
+{
+    const AtlasPlacement *placements = (const AtlasPlacement *)userdata;
+    int ia = *(const int *)a;
+    int ib = *(const int *)b;
+    int ha = placements[ia].surface->h;
+    int hb = placements[ib].surface->h;
+    if (ha != hb)
+        return hb - ha;
+    return ia - ib;
+}
+
+/**
+ * @brief Assigns every sprite a page and position with a shelf packer.
+ * Sprites are placed left to right on horizontal shelves, tallest first; a shelf that would
+ * run off the bottom of the page opens the next page.
+ * @param placements Decoded sprites, one per AtlasSpriteId; page/x/y are filled in.
+ * @param page_size Side length of a page in pixels.
+ * @param page_heights Receives the used height of each page.
+ * @return Number of pages used, or 0 if a sprite does not fit (error set).
+ */
+static int pack_sprites(AtlasPlacement *placements, int page_size, int page_heights[ATLAS_MAX_PAGES])
+{
+    int order[ATLAS_SPRITE_COUNT];
+    for (int i = 0; i < ATLAS_SPRITE_COUNT; ++i)
+        order[i] = i;
+
+    SDL_qsort_r(order, ATLAS_SPRITE_COUNT, sizeof(int), compare_heights, placements);
+
+    int page = 0;
+    int shelf_x = 0, shelf_y = 0, shelf_h = 0;
+    SDL_memset(page_heights, 0, sizeof(int) * ATLAS_MAX_PAGES);
+
+    for (int i = 0; i < ATLAS_SPRITE_COUNT; ++i)
+    {
+        AtlasPlacement *p = &placements[order[i]];
+        int w = p->surface->w + ATLAS_PADDING;
+        int h = p->surface->h + ATLAS_PADDING;
+
+        if (w > page_size || h > page_size)
+        {
+            SDL_SetError("Sprite '%s' (%dx%d) is larger than an atlas page (%d)", sprite_paths[order[i]], p->surface->w, p->surface->h, page_size);
+            return 0;
+        }
+
+        // Start a new shelf when this row is full, and a new page when the shelves are
+        if (shelf_x + w > page_size)
+        {
+            shelf_y += shelf_h;
+            shelf_x = 0;
+            shelf_h = 0;
+        }
+        if (shelf_y + h > page_size)
+        {
+            if (++page >= ATLAS_MAX_PAGES)
+            {
+                SDL_SetError("Sprites do not fit in %d atlas pages of %d pixels", ATLAS_MAX_PAGES, page_size);
+                return 0;
+            }
+            shelf_x = 0;
+            shelf_y = 0;
+            shelf_h = 0;
+        }
+
+        p->page = page;
+        p->x = shelf_x;
+        p->y = shelf_y;
+        shelf_x += w;
+        shelf_h = SDL_max(shelf_h, h);
+        page_heights[page] = SDL_max(page_heights[page], shelf_y + h);
+    }
+
+    return page + 1;
+}
+
+/**
+ * @brief Blits the sprites placed on one page into a surface and uploads it.
+ * @param renderer The renderer to create the texture with.
+ * @param placements Packed sprites.
+ * @param page Page to build.
+ * @param width Page width in pixels.
+ * @param height Page height in pixels.
+ * @return The page texture, or NULL on failure.
+ */
+static SDL_Texture *build_page(SDL_Renderer *renderer, const AtlasPlacement *placements, int page, int width, int height)
+{
+    SDL_Surface *page_surface = SDL_CreateSurface(width, height, SDL_PIXELFORMAT_RGBA32);
+    if (!page_surface)
+        return NULL;
+
+    // New surfaces are zeroed, so the padding between sprites stays fully transparent
+    for (int i = 0; i < ATLAS_SPRITE_COUNT; ++i)
+    {
+        const AtlasPlacement *p = &placements[i];
+        if (p->page != page)
+            continue;
+
+        SDL_Rect dst = {p->x, p->y, p->surface->w, p->surface->h};
+        SDL_SetSurfaceBlendMode(p->surface, SDL_BLENDMODE_NONE); // Copy alpha as-is instead of blending onto black
+        if (!SDL_BlitSurface(p->surface, NULL, page_surface, &dst))
+        {
+            SDL_DestroySurface(page_surface);
+            return NULL;
+        }
+    }
+
+    SDL_Texture *texture = SDL_CreateTextureFromSurface(renderer, page_surface);
+    SDL_DestroySurface(page_surface);
+    if (texture)
+    {
+        // Use nearest neighbor scaling for pixel art.
+        SDL_SetTextureScaleMode(texture, SDL_SCALEMODE_NEAREST);
+    }
+    return texture;
+}
+
+/**
+ * @brief Packs the decoded sprites and uploads the atlas pages.
+ * Runs on the main thread once the AssetLoader has decoded every sprite. Regions were handed
+ * out at init, so they are filled in place and sprites simply start drawing from here on.
+ * @param state Pointer to the main AppState.
+ * @param surfaces Decoded sprites, indexed by AtlasSpriteId.
+ * @param count Number of entries in surfaces (ATLAS_SPRITE_COUNT).
+ */
+static void atlas_images_ready(AppState *state, SDL_Surface **surfaces, int count)
+{
+    TextureAtlas atlas = state->texture_atlas;
+    if (!atlas || count != ATLAS_SPRITE_COUNT)
+        return;
+
+    AtlasPlacement placements[ATLAS_SPRITE_COUNT] = {0};
+    bool ok = true;
+
+    for (int i = 0; i < ATLAS_SPRITE_COUNT; ++i)
+    {
+        placements[i].surface = surfaces[i];
+        if (!surfaces[i])
+        {
+            SDL_LogError(SDL_LOG_CATEGORY_ERROR, "[TextureAtlas] Missing sprite '%s'", sprite_paths[i]);
+            ok = false;
+        }
+    }
+
+    // --- Pack Into Pages ---
+    int page_size = (int)SDL_GetNumberProperty(SDL_GetRendererProperties(state->renderer),
+                                               SDL_PROP_RENDERER_MAX_TEXTURE_SIZE_NUMBER, ATLAS_MAX_PAGE_SIZE);
+    page_size = SDL_min(page_size, ATLAS_MAX_PAGE_SIZE);
+
+    int page_heights[ATLAS_MAX_PAGES];
+    int page_count = 0;
+    if (ok)
+    {
+        page_count = pack_sprites(placements, page_size, page_heights);
+        if (page_count == 0)
+        {
+            SDL_LogError(SDL_LOG_CATEGORY_ERROR, "[TextureAtlas] Packing failed: %s", SDL_GetError());
+            ok = false;
+        }
+    }
+
+    for (int page = 0; ok && page < page_count; ++page)
+    {
+        atlas->pages[page] = build_page(state->renderer, placements, page, page_size, page_heights[page]);
+        atlas->page_count = page + 1;
+        if (!atlas->pages[page])
+        {
+            SDL_LogError(SDL_LOG_CATEGORY_ERROR, "[TextureAtlas] Failed to build page %d: %s", page, SDL_GetError());
+            ok = false;
+        }
+    }
+
+    if (!ok)
+    {
+        // Nothing could be drawn without the atlas
+        state->quit_requested = true;
+        return;
+    }
+
+    // --- Build Lookup Table ---
+    for (int i = 0; i < ATLAS_SPRITE_COUNT; ++i)
+    {
+        atlas->regions[i].texture = atlas->pages[placements[i].page];
+        atlas->regions[i].rect = (SDL_FRect){(float)placements[i].x, (float)placements[i].y,
+                                             (float)placements[i].surface->w, (float)placements[i].surface->h};
+    }
+
+    SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "TextureAtlas packed %d sprites into %d page(s) of width %d.",
+                ATLAS_SPRITE_COUNT, atlas->page_count, page_size);
+}
+
+// --- Static Callback Functions (for EntityManager) ---
+
+/**
+ * @brief Wrapper function conforming to EntityFunctions.cleanup signature.
+ * @param manager The EntityManager instance (unused).
+ * @param state Pointer to the main AppState.
+ */
+static void texture_atlas_cleanup_callback(EntityManager manager, AppState *state)
+{
+    (void)manager;
+    if (!state || !state->texture_atlas)
+        return;
+
+    TextureAtlas_Destroy(state->texture_atlas);
+    state->texture_atlas = NULL;
+}
+
+// --- Public API Function Implementations ---
+
+TextureAtlas TextureAtlas_Init(AppState *state)
+{
+    if (!state || !state->entity_manager || !state->renderer || !state->asset_loader)
+    {
+        SDL_SetError("Invalid AppState or missing entity_manager/renderer/asset_loader for TextureAtlas_Init");
+        return NULL;
+    }
+
+    TextureAtlas atlas = (TextureAtlas)SDL_calloc(1, sizeof(struct TextureAtlas_s));
+    if (!atlas)
+    {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+
+    // --- Queue Sprites ---
+    // Regions keep a NULL texture until the pages exist, which SpriteBatch skips
+    if (!AssetLoader_QueueImages(state->asset_loader, sprite_paths, ATLAS_SPRITE_COUNT, atlas_images_ready))
+    {
+        SDL_LogError(SDL_LOG_CATEGORY_ERROR, "[TextureAtlas Init] Failed to queue sprites: %s", SDL_GetError());
+        SDL_free(atlas);
+        return NULL;
+    }
+
+    // --- Register with EntityManager ---
+    EntityFunctions atlas_funcs = {
+        .name = "texture_atlas",
+        .cleanup = texture_atlas_cleanup_callback,
+        .update = NULL,
+        .render = NULL,
+        .handle_events = NULL};
+
+    if (!EntityManager_Add(state->entity_manager, &atlas_funcs))
+    {
+        SDL_LogError(SDL_LOG_CATEGORY_ERROR, "[TextureAtlas Init] Failed to add entity to manager: %s", SDL_GetError());
+        TextureAtlas_Destroy(atlas);
+        return NULL;
+    }
+
+    SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "TextureAtlas initialized, %d sprites queued for packing.", ATLAS_SPRITE_COUNT);
+    return atlas;
+}
+
+void TextureAtlas_Destroy(TextureAtlas atlas)
+{
+    if (atlas)
+    {
+        for (int i = 0; i < atlas->page_count; ++i)
+        {
+            if (atlas->pages[i])
+                SDL_DestroyTexture(atlas->pages[i]);
+        }
+        SDL_free(atlas);
+        SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "TextureAtlas destroyed.");
+    }
+}
+
+const AtlasRegion *TextureAtlas_Get(TextureAtlas atlas, AtlasSpriteId id)
+{
+    if (!atlas || id < 0 || id >= ATLAS_SPRITE_COUNT)
+        return NULL;
+    return &atlas->regions[id];
+}
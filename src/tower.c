@@ -9,7 +9,7 @@
  */
 static void render_single_tower(const TowerInstance *tower, AppState *state)
 {
-    if (!tower || !tower->texture || !state || !state->renderer || !state->camera_state)
+    if (!tower || !tower->sprite || !state || !state->renderer || !state->camera_state)
     {
         return;
     }
@@ -28,17 +28,14 @@ static void render_single_tower(const TowerInstance *tower, AppState *state)
         .w = TOWER_RENDER_WIDTH,
         .h = TOWER_RENDER_HEIGHT};
 
-    SDL_RenderTexture(state->renderer, tower->texture, NULL, &dst_rect);
+    SpriteBatch_DrawRegion(state->sprite_batch, tower->sprite, NULL, &dst_rect, 0.0, SDL_FLIP_NONE, SPRITE_DEPTH_BUILDINGS);
 
     char text_buffer[16];
     snprintf(text_buffer, sizeof(text_buffer), "%.0f/%d", tower->current_health, TOWER_HEALTH_MAX);
 
-    char tower_name[32];
-    snprintf(tower_name, sizeof(tower_name), "tower_%d_health_value", tower->index);
-
     SDL_Color team_color = tower->team ? (SDL_Color){255, 0, 0, 255} : (SDL_Color){0, 0, 255, 255};
 
-    update_hud_instance(state, get_hud_index_by_name(state, tower_name), text_buffer,
+    update_hud_instance(state, tower->hud_handle, text_buffer,
                         team_color, (SDL_FPoint){towerX, towerY - 30}, 0);
 }
 
@@ -73,8 +70,12 @@ static void update_single_tower(TowerInstance *tower, AppState *state, int tower
         bool target_found = false;
         float min_dist_sq = TOWER_ATTACK_RANGE * TOWER_ATTACK_RANGE;
 
-        for (int i = 0; i < MAX_CLIENTS; ++i)
+        // Players are considered before minions, so an equally distant minion still wins as before
+        int hit_count = 0;
+        const SpatialHit *hits = SpatialHash_QueryRange(state->spatial_hash, tower->position, TOWER_ATTACK_RANGE, SPATIAL_KIND_PLAYER, &hit_count);
+        for (int h = 0; h < hit_count; ++h)
         {
+            int i = hits[h].index;
             if (pm->players[i].active && pm->players[i].team != tower->team)
             {
                 SDL_FPoint player_pos;
@@ -94,8 +95,10 @@ static void update_single_tower(TowerInstance *tower, AppState *state, int tower
             }
         }
 
-        for (int i = 0; i < MINION_MAX_AMOUNT; i++)
+        hits = SpatialHash_QueryRange(state->spatial_hash, tower->position, TOWER_ATTACK_RANGE, SPATIAL_KIND_MINION, &hit_count);
+        for (int h = 0; h < hit_count; h++)
         {
+            int i = hits[h].index;
             SDL_FPoint minion_pos;
             if (tower->team != mm->minions[i].team)
             {
@@ -165,27 +168,6 @@ static void Internal_TowerManagerRender(TowerManagerState tm_state, AppState *st
     }
 }
 
-/**
- * @brief Internal function to clean up TowerManager resources.
- * @param tm_state The internal state of the tower manager module.
- */
-static void Internal_TowerManagerCleanup(TowerManagerState tm_state)
-{
-    if (!tm_state)
-        return;
-    SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "Cleaning up TowerManager resources...");
-    if (tm_state->red_texture)
-    {
-        SDL_DestroyTexture(tm_state->red_texture);
-        tm_state->red_texture = NULL;
-    }
-    if (tm_state->blue_texture)
-    {
-        SDL_DestroyTexture(tm_state->blue_texture);
-        tm_state->blue_texture = NULL;
-    }
-}
-
 /**
  * @brief Wrapper function conforming to EntityFunctions.update signature.
  * @param manager The EntityManager instance.
@@ -216,7 +198,7 @@ static void tower_manager_render_callback(EntityManager manager, AppState *state
 static void tower_manager_cleanup_callback(EntityManager manager, AppState *state)
 {
     (void)manager; // Manager instance is not used in this specific implementation
-    Internal_TowerManagerCleanup(state ? state->tower_manager : NULL);
+    // Sprites belong to the texture atlas, so there is nothing to release here
     if (state)
     {
         state->tower_manager = NULL; // Indicate cleanup happened
@@ -227,9 +209,9 @@ static void tower_manager_cleanup_callback(EntityManager manager, AppState *stat
 
 TowerManagerState TowerManager_Init(AppState *state)
 {
-    if (!state || !state->renderer || !state->entity_manager)
+    if (!state || !state->entity_manager)
     {
-        SDL_SetError("Invalid AppState or missing renderer/entity_manager for TowerManager_Init");
+        SDL_SetError("Invalid AppState or missing entity_manager for TowerManager_Init");
         return NULL;
     }
 
@@ -242,45 +224,15 @@ TowerManagerState TowerManager_Init(AppState *state)
     }
     tm_state->tower_count = 0;
 
-    // --- Load Resources ---
-    const char red_tower_path[] = "./resources/Sprites/Red_Team/Tower_Red.png";
-    const char blue_tower_path[] = "./resources/Sprites/Blue_Team/Tower_Blue.png";
-    const char destroyed_tower_path[] = "./resources/Sprites/Tower_Destroyed.png";
-
-    tm_state->red_texture = IMG_LoadTexture(state->renderer, red_tower_path);
-    if (!tm_state->red_texture)
-    {
-        SDL_LogError(SDL_LOG_CATEGORY_ERROR, "[Tower Init] Failed load texture '%s': %s", red_tower_path, SDL_GetError());
-        SDL_free(tm_state);
-        return NULL;
-    }
-    SDL_SetTextureScaleMode(tm_state->red_texture, SDL_SCALEMODE_NEAREST);
-
-    tm_state->blue_texture = IMG_LoadTexture(state->renderer, blue_tower_path);
-    if (!tm_state->blue_texture)
-    {
-        SDL_LogError(SDL_LOG_CATEGORY_ERROR, "[Tower Init] Failed load texture '%s': %s", blue_tower_path, SDL_GetError());
-        SDL_DestroyTexture(tm_state->red_texture); // Clean up already loaded texture
-        SDL_free(tm_state);
-        return NULL;
-    }
-    SDL_SetTextureScaleMode(tm_state->blue_texture, SDL_SCALEMODE_NEAREST);
-
-    tm_state->destroyed_texture = IMG_LoadTexture(state->renderer, destroyed_tower_path);
-    if (!tm_state->destroyed_texture)
-    {
-        SDL_LogError(SDL_LOG_CATEGORY_ERROR, "[Tower Init] Failed load texture '%s': %s", destroyed_tower_path, SDL_GetError());
-        SDL_DestroyTexture(tm_state->red_texture); // Clean up already loaded texture
-        SDL_free(tm_state);
-        return NULL;
-    }
-    SDL_SetTextureScaleMode(tm_state->destroyed_texture, SDL_SCALEMODE_NEAREST);
+    // --- Look Up Sprites (NULL without a renderer, e.g. on a dedicated server) ---
+    const AtlasRegion *red_sprite = TextureAtlas_Get(state->texture_atlas, ATLAS_SPRITE_TOWER_RED);
+    const AtlasRegion *blue_sprite = TextureAtlas_Get(state->texture_atlas, ATLAS_SPRITE_TOWER_BLUE);
 
     for (int i = 0; i < MAX_TOWERS_PER_TEAM; i++)
     {
         tm_state->towers[i] = (TowerInstance){
             .position = {TOWER_RED_1_X + i * TOWER_DISTANCE_X, BUILDINGS_POS_Y},
-            .texture = tm_state->red_texture,
+            .sprite = red_sprite,
             .current_health = TOWER_HEALTH_MAX,
             .attack_cooldown_timer = 0.0f,
             .team = RED_TEAM,
@@ -299,14 +251,14 @@ TowerManagerState TowerManager_Init(AppState *state)
         char tower_name[32];
         snprintf(tower_name, sizeof(tower_name), "tower_%d_health_value", i);
 
-        create_hud_instance(state, get_hud_element_count(state->HUD_manager), tower_name, true);
+        tm_state->towers[i].hud_handle = create_hud_instance(state, tower_name, true);
     }
 
     for (int i = MAX_TOWERS_PER_TEAM; i < MAX_TOTAL_TOWERS; i++)
     {
         tm_state->towers[i] = (TowerInstance){
             .position = {TOWER_BLUE_1_X - (i - MAX_TOWERS_PER_TEAM) * TOWER_DISTANCE_X, BUILDINGS_POS_Y},
-            .texture = tm_state->blue_texture,
+            .sprite = blue_sprite,
             .current_health = TOWER_HEALTH_MAX,
             .attack_cooldown_timer = 0.0f,
             .team = BLUE_TEAM,
@@ -325,7 +277,7 @@ TowerManagerState TowerManager_Init(AppState *state)
         char tower_name[32];
         snprintf(tower_name, sizeof(tower_name), "tower_%d_health_value", i);
 
-        create_hud_instance(state, get_hud_element_count(state->HUD_manager), tower_name, true);
+        tm_state->towers[i].hud_handle = create_hud_instance(state, tower_name, true);
     }
 
     tm_state->tower_count = MAX_TOTAL_TOWERS;
@@ -341,7 +293,6 @@ TowerManagerState TowerManager_Init(AppState *state)
     if (!EntityManager_Add(state->entity_manager, &tower_funcs))
     {
         SDL_LogError(SDL_LOG_CATEGORY_ERROR, "[Tower Init] Failed to add entity to manager: %s", SDL_GetError());
-        Internal_TowerManagerCleanup(tm_state); // Cleanup loaded textures
         SDL_free(tm_state);
         return NULL;
     }
@@ -352,12 +303,8 @@ TowerManagerState TowerManager_Init(AppState *state)
 
 void TowerManager_Destroy(TowerManagerState tm_state)
 {
-    // Cleanup callback handles texture destruction.
     if (tm_state)
     {
-        // Prevent dangling pointers after cleanup callback potentially ran via EntityManager
-        tm_state->red_texture = NULL;
-        tm_state->blue_texture = NULL;
         SDL_free(tm_state);
         SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "TowerManagerState container destroyed.");
     }
@@ -385,7 +332,7 @@ void damageTower(AppState state, int towerIndex, float damageValue, bool sendToS
 
     if (tempTower->current_health <= 0)
     {
-        tempTower->texture = state.tower_manager->destroyed_texture;
+        tempTower->sprite = TextureAtlas_Get(state.texture_atlas, ATLAS_SPRITE_TOWER_DESTROYED);
         tempTower->destroyed = true;
         SDL_Log("Tower %d Destroyed", towerIndex);
 
@@ -1,31 +1,38 @@
 #include "../include/update.h"
 
-// --- Public Functions ---
+// --- Static Helper Functions ---
 
-void app_update(void *appstate)
+/**
+ * @brief Advances the shared clock, moving its offset toward the newest estimate.
+ * The offset changes by at most CLOCK_SLEW_MS_PER_TICK per tick, so cooldowns and spawn timers
+ * see no jumps; only a clock far behind jumps forward. The clock never runs backwards.
+ * @param state Pointer to the main AppState.
+ */
+static void advance_sync_clock(AppState *state)
 {
-  AppState *state = (AppState *)appstate;
-
-  // --- Calculate Delta Time ---
-  state->last_tick = state->current_tick;
-  state->current_tick = SDL_GetTicks();
-  // Handle first frame case to avoid large initial delta_time
-  if (state->last_tick == 0)
+  Sint64 error = state->clock_target_offset_ms - state->clock_offset_ms;
+  if (error > CLOCK_SNAP_MS)
   {
-    state->last_tick = state->current_tick - 16; // Assume ~60 fps for first frame
+    state->clock_offset_ms = state->clock_target_offset_ms;
   }
-  Uint64 delta_ticks = state->current_tick - state->last_tick;
-  state->delta_time = (float)delta_ticks / 1000.0f;
-  // Clamp delta_time to prevent large jumps (e.g., after debugging pause)
-  const float max_delta_time = 0.1f; // Max delta = 100ms (10 FPS)
-  if (state->delta_time > max_delta_time)
+  else
   {
-    state->delta_time = max_delta_time;
+    state->clock_offset_ms += CLAMP(error, -CLOCK_SLEW_MS_PER_TICK, CLOCK_SLEW_MS_PER_TICK);
   }
 
-  state->sync_clock = SDL_GetTicks() - state->client_start_time + state->server_start_time;
+  Sint64 clock = (Sint64)SDL_GetTicks() + state->clock_offset_ms;
+  if (clock > (Sint64)state->sync_clock)
+  {
+    state->sync_clock = (Uint64)clock;
+  }
+}
+
+// --- Public Functions ---
+
+void app_tick(AppState *state)
+{
+  advance_sync_clock(state);
 
-  // --- Update Entities ---
   // Delegate entity updates to the EntityManager.
   if (state->entity_manager)
   {
@@ -33,6 +40,34 @@ void app_update(void *appstate)
   }
   else
   {
-    SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "EntityManager not initialized in app_update.");
+    SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "EntityManager not initialized in app_tick.");
   }
 }
+
+void app_update(void *appstate)
+{
+  AppState *state = (AppState *)appstate;
+
+  // --- Accumulate Elapsed Time ---
+  Uint64 now_ns = SDL_GetTicksNS();
+  // Handle first frame case so the simulation starts with exactly one tick
+  Uint64 frame_ns = state->frame_start_ns ? now_ns - state->frame_start_ns : SIM_TICK_NS;
+  state->frame_start_ns = now_ns;
+  state->accumulator_ns += frame_ns;
+  // Drop backlog that could not be simulated anyway (e.g., after a debugging pause)
+  if (state->accumulator_ns > SIM_MAX_TICKS_PER_FRAME * SIM_TICK_NS)
+  {
+    state->accumulator_ns = SIM_MAX_TICKS_PER_FRAME * SIM_TICK_NS;
+  }
+
+  state->delta_time = 1.0f / SIM_TICK_RATE;
+
+  // --- Run Fixed Ticks ---
+  while (state->accumulator_ns >= SIM_TICK_NS)
+  {
+    state->accumulator_ns -= SIM_TICK_NS;
+    app_tick(state);
+  }
+
+  state->render_alpha = (float)state->accumulator_ns / (float)SIM_TICK_NS;
+}
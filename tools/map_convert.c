@@ -0,0 +1,202 @@
+/*
+ * map_convert - compiles a Tiled JSON map export into the binary format in include/map_format.h.
+ *
+ * Usage: map_convert <input.json> <output.lmap>
+ *
+ * Built and run by the makefile whenever the JSON export changes, so the game never parses JSON.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define CUTE_TILED_IMPLEMENTATION
+#include "../include/cute_tiled.h"
+#include "../include/map_format.h"
+
+// --- Static Helper Functions ---
+
+/**
+ * @brief Rounds a byte offset up to the format's 4-byte section alignment.
+ * @param offset The offset to align.
+ * @return The aligned offset.
+ */
+static uint32_t align4(uint32_t offset)
+{
+    return (offset + 3u) & ~3u;
+}
+
+/**
+ * @brief Tells whether a layer ends up in the binary map.
+ * Only visible tile layers are drawn, so nothing else is written.
+ * @param layer The Tiled layer.
+ * @return 1 if the layer is emitted, 0 otherwise.
+ */
+static int is_emitted_layer(const cute_tiled_layer_t *layer)
+{
+    return strcmp(layer->type.ptr, "tilelayer") == 0 && layer->visible && layer->data;
+}
+
+/**
+ * @brief Checks the parsed map against what the binary format can describe.
+ * @param map The parsed Tiled map.
+ * @return 1 if the map can be converted, 0 otherwise (reason printed).
+ */
+static int validate_map(const cute_tiled_map_t *map)
+{
+    if (strcmp(map->orientation.ptr, "orthogonal") != 0 || map->infinite)
+    {
+        fprintf(stderr, "map_convert: only finite orthogonal maps are supported\n");
+        return 0;
+    }
+    if (map->width <= 0 || map->height <= 0 || map->tilewidth <= 0 || map->tileheight <= 0)
+    {
+        fprintf(stderr, "map_convert: invalid map dimensions %dx%d (tiles %dx%d)\n",
+                map->width, map->height, map->tilewidth, map->tileheight);
+        return 0;
+    }
+
+    for (const cute_tiled_tileset_t *tileset = map->tilesets; tileset; tileset = tileset->next)
+    {
+        if (!tileset->image.ptr)
+        {
+            fprintf(stderr, "map_convert: tileset (gid %d) has no image path\n", tileset->firstgid);
+            return 0;
+        }
+        if (strlen(tileset->image.ptr) >= MAP_BIN_IMAGE_PATH_MAX)
+        {
+            fprintf(stderr, "map_convert: tileset image path '%s' is longer than %d characters\n",
+                    tileset->image.ptr, MAP_BIN_IMAGE_PATH_MAX - 1);
+            return 0;
+        }
+        if (tileset->firstgid + tileset->tilecount > UINT16_MAX + 1)
+        {
+            fprintf(stderr, "map_convert: tileset '%s' has GIDs beyond 16 bits\n", tileset->image.ptr);
+            return 0;
+        }
+    }
+
+    for (const cute_tiled_layer_t *layer = map->layers; layer; layer = layer->next)
+    {
+        if (is_emitted_layer(layer) && layer->data_count != map->width * map->height)
+        {
+            fprintf(stderr, "map_convert: layer '%s' has %d tiles, expected %d\n",
+                    layer->name.ptr, layer->data_count, map->width * map->height);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/**
+ * @brief Writes the binary map.
+ * @param map The validated Tiled map.
+ * @param out_path Path of the file to write.
+ * @return 1 on success, 0 on failure (reason printed).
+ */
+static int write_map(const cute_tiled_map_t *map, const char *out_path)
+{
+    uint32_t tileset_count = 0;
+    for (const cute_tiled_tileset_t *tileset = map->tilesets; tileset; tileset = tileset->next)
+        tileset_count++;
+
+    uint32_t layer_count = 0;
+    for (const cute_tiled_layer_t *layer = map->layers; layer; layer = layer->next)
+        layer_count += is_emitted_layer(layer) ? 1u : 0u;
+
+    size_t tiles_per_layer = (size_t)map->width * (size_t)map->height;
+
+    MapBinHeader header = {0};
+    header.magic = MAP_BIN_MAGIC;
+    header.version = MAP_BIN_VERSION;
+    header.width = (uint32_t)map->width;
+    header.height = (uint32_t)map->height;
+    header.tile_width = (uint32_t)map->tilewidth;
+    header.tile_height = (uint32_t)map->tileheight;
+    header.tileset_count = tileset_count;
+    header.tileset_offset = align4((uint32_t)sizeof(MapBinHeader));
+    header.layer_count = layer_count;
+    header.layer_offset = align4(header.tileset_offset + tileset_count * (uint32_t)sizeof(MapBinTileset));
+    header.file_size = header.layer_offset + (uint32_t)(layer_count * tiles_per_layer * sizeof(uint16_t));
+
+    // Built in memory first so a failed conversion never leaves a truncated map behind
+    unsigned char *blob = (unsigned char *)calloc(1, header.file_size);
+    if (!blob)
+    {
+        fprintf(stderr, "map_convert: out of memory\n");
+        return 0;
+    }
+    memcpy(blob, &header, sizeof(header));
+
+    MapBinTileset *tilesets = (MapBinTileset *)(blob + header.tileset_offset);
+    for (const cute_tiled_tileset_t *tileset = map->tilesets; tileset; tileset = tileset->next, tilesets++)
+    {
+        tilesets->firstgid = (uint32_t)tileset->firstgid;
+        tilesets->tilecount = (uint32_t)tileset->tilecount;
+        tilesets->columns = (uint32_t)tileset->columns;
+        strcpy(tilesets->image, tileset->image.ptr);
+    }
+
+    uint16_t *gids = (uint16_t *)(blob + header.layer_offset);
+    int dropped = 0;
+    for (const cute_tiled_layer_t *layer = map->layers; layer; layer = layer->next)
+    {
+        if (!is_emitted_layer(layer))
+            continue;
+
+        for (size_t i = 0; i < tiles_per_layer; ++i)
+        {
+            // Flipped tiles carry flag bits above 16 bits; the renderer has never drawn them, so they stay empty
+            unsigned int gid = (unsigned int)layer->data[i];
+            if (gid > UINT16_MAX)
+            {
+                gid = 0;
+                dropped++;
+            }
+            gids[i] = (uint16_t)gid;
+        }
+        gids += tiles_per_layer;
+    }
+    if (dropped)
+        fprintf(stderr, "map_convert: warning: %d flipped or out-of-range tiles left empty\n", dropped);
+
+    FILE *file = fopen(out_path, "wb");
+    int ok = file && fwrite(blob, 1, header.file_size, file) == header.file_size;
+    if (file && fclose(file) != 0)
+        ok = 0;
+    if (!ok)
+    {
+        fprintf(stderr, "map_convert: failed to write '%s'\n", out_path);
+        remove(out_path);
+    }
+    else
+    {
+        printf("map_convert: %s: %ux%u tiles, %u layer(s), %u tileset(s), %u bytes\n",
+               out_path, header.width, header.height, layer_count, tileset_count, header.file_size);
+    }
+
+    free(blob);
+    return ok;
+}
+
+// --- Entry Point ---
+
+int main(int argc, char *argv[])
+{
+    if (argc != 3)
+    {
+        fprintf(stderr, "Usage: %s <input.json> <output.lmap>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    cute_tiled_map_t *map = cute_tiled_load_map_from_file(argv[1], NULL);
+    if (!map)
+    {
+        fprintf(stderr, "map_convert: failed to load '%s': %s\n", argv[1], cute_tiled_error_reason);
+        return EXIT_FAILURE;
+    }
+
+    int ok = validate_map(map) && write_map(map, argv[2]);
+    cute_tiled_free_map(map);
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}